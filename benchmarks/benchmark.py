@@ -8,6 +8,7 @@ génère des statistiques de performance.
 Métriques mesurées :
 - Temps d'exécution (moyenne sur plusieurs runs)
 - Écart-type du temps
+- Mémoire de pointe (pic tracemalloc + delta RSS, run dédié)
 - Nombre de composantes connexes trouvées
 - Vérification de la cohérence des résultats
 
@@ -32,7 +33,10 @@ from src.algorithms.two_pass import TwoPass
 from src.algorithms.union_find import UnionFind
 from src.algorithms.kruskal import Kruskal
 from src.algorithms.prim import Prim
-from src.utils.utils import Timer, mean, standard_deviation, min_array, max_array
+from src.algorithms.rle import RunLength
+from src.algorithms import NATIVE_BACKEND
+from src.utils.utils import (Timer, mean, standard_deviation, min_array,
+                             max_array, measure_peak_memory)
 
 
 @dataclass
@@ -43,6 +47,8 @@ class AlgorithmResult:
     std_dev: float        # Écart-type (ms)
     min_time: float       # Temps minimum (ms)
     max_time: float       # Temps maximum (ms)
+    peak_mem_kb: float    # Pic d'allocations Python (Ko, tracemalloc)
+    rss_delta_kb: float   # Croissance de la mémoire résidente (Ko)
     num_components: int   # Nombre de composantes trouvées
 
 
@@ -68,26 +74,34 @@ def benchmark_algorithm(algo_name: str, input_image: Image,
     Returns:
         Résultat du benchmark
     """
-    times = []
-    labels = None
-
-    for _ in range(num_runs):
-        timer = Timer()
-        timer.start()
 
-        # Exécuter l'algorithme
+    def run_once() -> LabelImage:
         if algo_name == "Two-Pass":
-            labels = TwoPass.label(input_image, connectivity)
+            return TwoPass.label(input_image, connectivity)
         elif algo_name == "Union-Find":
-            labels = UnionFind.label(input_image, connectivity)
+            return UnionFind.label(input_image, connectivity)
         elif algo_name == "Kruskal":
-            labels = Kruskal.label(input_image, connectivity)
+            return Kruskal.label(input_image, connectivity)
         elif algo_name == "Prim":
-            labels = Prim.label(input_image, connectivity)
+            return Prim.label(input_image, connectivity)
+        elif algo_name == "RLE":
+            return RunLength.label(input_image, connectivity)
+        return None
 
+    times = []
+    labels = None
+
+    for _ in range(num_runs):
+        timer = Timer()
+        timer.start()
+        labels = run_once()
         elapsed = timer.stop()
         times.append(elapsed)
 
+    # Run dédié pour la mémoire : tracemalloc ralentit l'exécution,
+    # la mesure est donc faite hors des runs chronométrés
+    _, peak_mem_kb, rss_delta_kb = measure_peak_memory(run_once)
+
     # Calculer les statistiques
     return AlgorithmResult(
         name=algo_name,
@@ -95,6 +109,8 @@ def benchmark_algorithm(algo_name: str, input_image: Image,
         std_dev=standard_deviation(times),
         min_time=min_array(times),
         max_time=max_array(times),
+        peak_mem_kb=peak_mem_kb,
+        rss_delta_kb=rss_delta_kb,
         num_components=labels.count_labels() if labels else 0
     )
 
@@ -117,16 +133,27 @@ def print_results(results: List[AlgorithmResult], image_name: str,
     print("========================================\n")
 
     # Header du tableau
-    print(f"{'Algorithme':>15} {'Moyenne':>12} {'Ecart-type':>12} {'Min':>12} {'Max':>12} {'Composantes':>15}")
-    print("-" * 78)
+    print(f"{'Algorithme':>15} {'Moyenne':>12} {'Ecart-type':>12} {'Min':>12} {'Max':>12} "
+          f"{'Pic mem (Ko)':>14} {'Delta RSS':>12} {'Composantes':>13}")
+    print("-" * 110)
 
     # Résultats pour chaque algorithme
     for result in results:
         print(f"{result.name:>15} {result.mean_time:>12.2f} {result.std_dev:>12.2f} "
-              f"{result.min_time:>12.2f} {result.max_time:>12.2f} {result.num_components:>15}")
+              f"{result.min_time:>12.2f} {result.max_time:>12.2f} "
+              f"{result.peak_mem_kb:>14.1f} {result.rss_delta_kb:>12.1f} "
+              f"{result.num_components:>13}")
 
     print()
 
+    # Algorithme le plus econome en memoire
+    lightest_idx = 0
+    for i in range(1, len(results)):
+        if results[i].peak_mem_kb < results[lightest_idx].peak_mem_kb:
+            lightest_idx = i
+    print(f"Algorithme le plus econome en memoire: {results[lightest_idx].name} "
+          f"({results[lightest_idx].peak_mem_kb:.1f} Ko)")
+
     # Trouver l'algorithme le plus rapide
     fastest_idx = 0
     for i in range(1, len(results)):
@@ -168,10 +195,18 @@ def main():
 
     print("Configuration:")
     print(f"  Nombre de runs par algorithme: {config.num_runs}")
-    print(f"  Connectivite: {config.connectivity}\n")
+    print(f"  Connectivite: {config.connectivity}")
+    # Sans cette ligne, les speedups relatifs ne sont pas interprétables :
+    # avec le backend natif, les quatre algorithmes classiques partagent
+    # le même noyau C
+    if NATIVE_BACKEND:
+        print("  Backend: noyaux natifs (_labeling) -- "
+              "LABELLISATION_NO_NATIVE=1 pour mesurer le Python pur\n")
+    else:
+        print("  Backend: Python pur\n")
 
     # Liste des algorithmes à tester
-    algorithms = ["Two-Pass", "Union-Find", "Kruskal", "Prim"]
+    algorithms = ["Two-Pass", "Union-Find", "Kruskal", "Prim", "RLE"]
 
     # Pour chaque image fournie en argument
     for img_idx in range(1, len(sys.argv)):
@@ -20,6 +20,7 @@ from typing import List, Dict, Tuple
 
 # Ajouter le répertoire parent au path pour les imports
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
 
 from src.core.image import Image, LabelImage
 from src.algorithms.two_pass import TwoPass
@@ -28,6 +29,8 @@ from src.algorithms.kruskal import Kruskal
 from src.algorithms.prim import Prim
 from src.utils.utils import Timer
 
+import corpus
+
 # Essayer d'importer matplotlib pour les graphiques
 try:
     import matplotlib.pyplot as plt
@@ -56,36 +59,6 @@ def manual_std(values: List[float]) -> float:
     return variance ** 0.5
 
 
-# ============================================================================
-# Génération d'images de test
-# ============================================================================
-
-def create_test_image(size: int, density: float = 0.3) -> Image:
-    """
-    Crée une image de test avec des objets pseudo-aléatoires.
-
-    Args:
-        size: Dimension de l'image (size x size)
-        density: Densité d'objets (proportion de pixels blancs)
-
-    Returns:
-        Image binaire
-    """
-    image = Image(size, size)
-
-    # Génération pseudo-aléatoire déterministe basée sur la position
-    for x in range(size):
-        for y in range(size):
-            # Utilise une formule pseudo-aléatoire simple
-            val = ((x * 7 + y * 13) * 31) % 100
-            if val < density * 100:
-                image.set_at(x, y, 255)
-            else:
-                image.set_at(x, y, 0)
-
-    return image
-
-
 # ============================================================================
 # Benchmark de complexité
 # ============================================================================
@@ -130,13 +103,15 @@ def benchmark_single(image: Image, algorithm_name: str, connectivity: int) -> fl
     return elapsed
 
 
-def run_complexity_benchmark(sizes: List[int], num_runs: int = 5) -> Dict:
+def run_complexity_benchmark(sizes: List[int], num_runs: int = 5,
+                             pattern: str = 'noise_d30') -> Dict:
     """
     Execute le benchmark de complexité.
 
     Args:
         sizes: Liste des tailles d'images à tester
         num_runs: Nombre de runs par configuration
+        pattern: Motif du corpus synthetique (voir corpus.PATTERNS)
 
     Returns:
         Dictionnaire des résultats
@@ -148,6 +123,7 @@ def run_complexity_benchmark(sizes: List[int], num_runs: int = 5) -> Dict:
     print("=" * 60)
     print(f"\nConfiguration:")
     print(f"  - Tailles: {sizes}")
+    print(f"  - Motif: {pattern}")
     print(f"  - Runs par config: {num_runs}")
     print(f"  - Connectivite: 4")
     print()
@@ -157,8 +133,9 @@ def run_complexity_benchmark(sizes: List[int], num_runs: int = 5) -> Dict:
         print(f"  Taille: {size}x{size} ({size*size} pixels)")
         print(f"{'='*50}")
 
-        # Créer l'image de test
-        image = create_test_image(size)
+        # Charger l'image du corpus (generee et mise en cache au
+        # premier passage, relue en PGM ensuite)
+        image = corpus.get_image(pattern, size)
 
         for algo_name in ALGORITHMS:
             times = []
@@ -301,6 +278,9 @@ def main():
                         help='Nombre de runs par configuration (defaut: 5)')
     parser.add_argument('--sizes', type=str, default='64,128,256,512',
                         help='Tailles a tester, separees par des virgules')
+    parser.add_argument('--pattern', type=str, default='noise_d30',
+                        choices=sorted(corpus.PATTERNS.keys()),
+                        help='Motif du corpus synthetique (defaut: noise_d30)')
 
     args = parser.parse_args()
 
@@ -312,7 +292,7 @@ def main():
     os.chdir(project_dir)
 
     # Executer le benchmark
-    results = run_complexity_benchmark(sizes, args.runs)
+    results = run_complexity_benchmark(sizes, args.runs, args.pattern)
 
     # Exporter les resultats
     csv_path = 'benchmarks/results/complexity_results.csv'
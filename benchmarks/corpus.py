@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+"""
+Generateur de corpus d'images synthetiques pour les benchmarks
+
+Fournit des generateurs deterministes (germe fixe) de motifs binaires
+representatifs de nos charges reelles :
+- bruit a densite controlee (balayages de densite)
+- motifs de type texte (plages horizontales courtes, interlignes vides)
+- labyrinthes (pire cas pour les chaines union-find : une seule
+  composante tres sinueuse)
+- blob geant (une seule composante massive, pire cas pour les
+  remplissages par propagation)
+
+Les images sont ecrites une seule fois dans un repertoire cache au
+format PGM puis rechargees via ImageIO.read_pgm lors des executions
+suivantes : les benchmarks deviennent reproductibles d'une machine a
+l'autre et le temps de preparation des sweeps devient negligeable.
+
+Usage:
+    python corpus.py [--sizes 64,128,256] [--cache-dir benchmarks/corpus_cache]
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+import random
+from typing import Dict, List
+
+# Ajouter le repertoire parent au path pour les imports
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from src.core.image import Image
+from src.readers.image_io import ImageIO
+
+
+# Germe global du corpus : le changer invalide toutes les images
+# generees (penser a vider le repertoire cache)
+CORPUS_SEED = 20240915
+
+# Repertoire cache par defaut, relatif a la racine du projet
+DEFAULT_CACHE_DIR = 'benchmarks/corpus_cache'
+
+
+def _rng_for(pattern: str, size: int) -> random.Random:
+    """
+    Construit un generateur pseudo-aleatoire propre a un motif.
+
+    Le germe est derive du nom du motif et de la taille : chaque image
+    du corpus est independante et reproductible individuellement.
+
+    Args:
+        pattern: Nom du motif
+        size: Dimension de l'image
+
+    Returns:
+        Instance de random.Random initialisee
+    """
+    return random.Random(f"{CORPUS_SEED}:{pattern}:{size}")
+
+
+# ============================================================================
+# Generateurs de motifs
+# ============================================================================
+
+def generate_noise(size: int, density: float, rng: random.Random) -> Image:
+    """
+    Genere du bruit binaire a densite controlee.
+
+    Args:
+        size: Dimension de l'image (size x size)
+        density: Proportion de pixels objet (0.0 a 1.0)
+        rng: Generateur pseudo-aleatoire
+
+    Returns:
+        Image binaire
+    """
+    image = Image(size, size)
+    buf = image.buffer
+    threshold = density
+
+    for i in range(size * size):
+        if rng.random() < threshold:
+            buf[i] = 255
+
+    return image
+
+
+def generate_text(size: int, rng: random.Random) -> Image:
+    """
+    Genere un motif de type texte scanne.
+
+    Lignes de "caracteres" : plages horizontales courtes separees par
+    de petits espaces, avec des interlignes vides. C'est la charge
+    typique des algorithmes par plages (RLE).
+
+    Args:
+        size: Dimension de l'image (size x size)
+        rng: Generateur pseudo-aleatoire
+
+    Returns:
+        Image binaire
+    """
+    image = Image(size, size)
+    buf = image.buffer
+
+    line_height = 6   # Hauteur d'une ligne de texte
+    line_spacing = 3  # Interligne vide
+
+    x = 1
+    while x + line_height <= size:
+        for row in range(x, x + line_height):
+            y = rng.randint(0, 3)
+            base = row * size
+            while y < size:
+                run = rng.randint(2, 8)    # Largeur d'un trait
+                gap = rng.randint(1, 4)    # Espace intra-mot
+                end = min(y + run, size)
+                for j in range(base + y, base + end):
+                    buf[j] = 255
+                y = end + gap
+        x += line_height + line_spacing
+
+    return image
+
+
+def generate_maze(size: int, rng: random.Random) -> Image:
+    """
+    Genere un labyrinthe parfait (une seule composante sinueuse).
+
+    Creusement par retour sur trace (backtracker) sur une grille de
+    cellules impaires. Le couloir resultant est une unique composante
+    tres allongee : c'est le pire cas pour les chaines union-find et
+    les parcours de graphe.
+
+    Args:
+        size: Dimension de l'image (size x size)
+        rng: Generateur pseudo-aleatoire
+
+    Returns:
+        Image binaire (couloirs a 255, murs a 0)
+    """
+    image = Image(size, size)
+    buf = image.buffer
+
+    # Cellules sur les coordonnees impaires
+    cells_x = (size - 1) // 2
+    cells_y = (size - 1) // 2
+    if cells_x < 1 or cells_y < 1:
+        image.fill(255)
+        return image
+
+    visited = [[False] * cells_y for _ in range(cells_x)]
+    stack = [(0, 0)]
+    visited[0][0] = True
+    buf[1 * size + 1] = 255
+
+    while stack:
+        cx, cy = stack[-1]
+        candidates = []
+        for dx, dy in ((-1, 0), (1, 0), (0, -1), (0, 1)):
+            nx, ny = cx + dx, cy + dy
+            if 0 <= nx < cells_x and 0 <= ny < cells_y and not visited[nx][ny]:
+                candidates.append((nx, ny, dx, dy))
+
+        if not candidates:
+            stack.pop()
+            continue
+
+        nx, ny, dx, dy = rng.choice(candidates)
+        # Creuser le mur entre les deux cellules puis la cellule cible
+        wall_x = 2 * cx + 1 + dx
+        wall_y = 2 * cy + 1 + dy
+        buf[wall_x * size + wall_y] = 255
+        buf[(2 * nx + 1) * size + (2 * ny + 1)] = 255
+        visited[nx][ny] = True
+        stack.append((nx, ny))
+
+    return image
+
+
+def generate_blob(size: int, rng: random.Random) -> Image:
+    """
+    Genere un blob geant : un disque couvrant presque toute l'image.
+
+    Une seule composante massive, le centre etant legerement decale
+    de maniere deterministe pour eviter une symetrie parfaite.
+
+    Args:
+        size: Dimension de l'image (size x size)
+        rng: Generateur pseudo-aleatoire
+
+    Returns:
+        Image binaire
+    """
+    image = Image(size, size)
+    buf = image.buffer
+
+    jitter = size * 0.02
+    cx = (size - 1) / 2.0 + rng.uniform(-jitter, jitter)
+    cy = (size - 1) / 2.0 + rng.uniform(-jitter, jitter)
+    r2 = (size * 0.45) ** 2
+
+    for x in range(size):
+        base = x * size
+        dx = x - cx
+        for y in range(size):
+            dy = y - cy
+            if dx * dx + dy * dy <= r2:
+                buf[base + y] = 255
+
+    return image
+
+
+# ============================================================================
+# Catalogue du corpus
+# ============================================================================
+
+# Motifs disponibles : nom -> fonction (size, rng) -> Image
+PATTERNS = {
+    'noise_d10': lambda size, rng: generate_noise(size, 0.1, rng),
+    'noise_d30': lambda size, rng: generate_noise(size, 0.3, rng),
+    'noise_d50': lambda size, rng: generate_noise(size, 0.5, rng),
+    'noise_d70': lambda size, rng: generate_noise(size, 0.7, rng),
+    'text': generate_text,
+    'maze': generate_maze,
+    'blob': generate_blob,
+}
+
+
+def corpus_path(pattern: str, size: int, cache_dir: str = DEFAULT_CACHE_DIR) -> str:
+    """
+    Retourne le chemin cache d'une image du corpus.
+
+    Args:
+        pattern: Nom du motif (cle de PATTERNS)
+        size: Dimension de l'image
+        cache_dir: Repertoire cache
+
+    Returns:
+        Chemin du fichier PGM
+    """
+    return os.path.join(cache_dir, f"{pattern}_{size}x{size}.pgm")
+
+
+def get_image(pattern: str, size: int, cache_dir: str = DEFAULT_CACHE_DIR) -> Image:
+    """
+    Retourne une image du corpus, en la generant au besoin.
+
+    L'image est lue depuis le cache si elle existe deja ; sinon elle
+    est generee de maniere deterministe, ecrite en PGM dans le cache,
+    puis retournee.
+
+    Args:
+        pattern: Nom du motif (cle de PATTERNS)
+        size: Dimension de l'image
+        cache_dir: Repertoire cache
+
+    Returns:
+        Image binaire
+
+    Raises:
+        ValueError: Si le motif est inconnu
+    """
+    if pattern not in PATTERNS:
+        raise ValueError(f"Motif inconnu: {pattern} "
+                         f"(disponibles: {', '.join(sorted(PATTERNS))})")
+
+    path = corpus_path(pattern, size, cache_dir)
+    if os.path.exists(path):
+        return ImageIO.read_pgm(path)
+
+    image = PATTERNS[pattern](size, _rng_for(pattern, size))
+
+    os.makedirs(cache_dir, exist_ok=True)
+    ImageIO.write_pgm(path, image)
+    return image
+
+
+def build_corpus(sizes: List[int], patterns: List[str] = None,
+                 cache_dir: str = DEFAULT_CACHE_DIR) -> Dict[str, str]:
+    """
+    Genere (ou verifie) l'ensemble du corpus pour une liste de tailles.
+
+    Args:
+        sizes: Dimensions a generer
+        patterns: Motifs a generer (defaut: tous)
+        cache_dir: Repertoire cache
+
+    Returns:
+        Dictionnaire "motif_taille" -> chemin PGM
+    """
+    if patterns is None:
+        patterns = list(PATTERNS.keys())
+
+    paths = {}
+    for size in sizes:
+        for pattern in patterns:
+            get_image(pattern, size, cache_dir)
+            paths[f"{pattern}_{size}"] = corpus_path(pattern, size, cache_dir)
+
+    return paths
+
+
+def main():
+    """Point d'entree principal : pre-genere le corpus."""
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description='Genere le corpus d\'images synthetiques de benchmark'
+    )
+    parser.add_argument('--sizes', type=str, default='64,128,256,512',
+                        help='Tailles a generer, separees par des virgules')
+    parser.add_argument('--cache-dir', type=str, default=DEFAULT_CACHE_DIR,
+                        help=f'Repertoire cache (defaut: {DEFAULT_CACHE_DIR})')
+
+    args = parser.parse_args()
+
+    sizes = [int(s.strip()) for s in args.sizes.split(',')]
+
+    # Changer vers le repertoire du projet
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    os.chdir(project_dir)
+
+    paths = build_corpus(sizes, cache_dir=args.cache_dir)
+
+    print(f"Corpus pret: {len(paths)} images dans {args.cache_dir}")
+    for key in sorted(paths):
+        print(f"  - {paths[key]}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -50,6 +50,8 @@ class ResultEntry:
     min_time: float
     max_time: float
     num_components: int
+    peak_mem: float = 0.0    # Pic memoire (Ko), 0 si CSV ancien format
+    rss_delta: float = 0.0   # Delta RSS (Ko), 0 si CSV ancien format
 
 
 # ============================================================================
@@ -88,7 +90,9 @@ def load_csv(filepath: str) -> List[ResultEntry]:
                 std_time=float(row['std_time_ms']),
                 min_time=float(row['min_time_ms']),
                 max_time=float(row['max_time_ms']),
-                num_components=int(row['num_components'])
+                num_components=int(row['num_components']),
+                peak_mem=float(row.get('peak_mem_kb') or 0),
+                rss_delta=float(row.get('rss_delta_kb') or 0)
             )
             results.append(entry)
 
@@ -119,6 +123,10 @@ def graph_algorithm_comparison(results: List[ResultEntry], output_dir: str):
     """
     Graphique 1: Comparaison globale des algorithmes.
 
+    Deux panneaux cote a cote : temps moyen et memoire de pointe
+    (le panneau memoire est omis si le CSV ne contient pas les
+    colonnes memoire).
+
     Args:
         results: Liste des resultats
         output_dir: Repertoire de sortie
@@ -129,29 +137,39 @@ def graph_algorithm_comparison(results: List[ResultEntry], output_dir: str):
     # Grouper par algorithme
     algo_times: Dict[str, List[float]] = {}
     algo_stds: Dict[str, List[float]] = {}
+    algo_mems: Dict[str, List[float]] = {}
 
     for r in results:
         if r.algorithm not in algo_times:
             algo_times[r.algorithm] = []
             algo_stds[r.algorithm] = []
+            algo_mems[r.algorithm] = []
         algo_times[r.algorithm].append(r.mean_time)
         algo_stds[r.algorithm].append(r.std_time)
+        algo_mems[r.algorithm].append(r.peak_mem)
 
     # Calculer les moyennes
     algorithms = list(algo_times.keys())
     means = [manual_mean(algo_times[a]) for a in algorithms]
     stds = [manual_mean(algo_stds[a]) for a in algorithms]
+    mems = [manual_mean(algo_mems[a]) for a in algorithms]
     colors = [ALGO_COLORS.get(a, '#95a5a6') for a in algorithms]
     labels = [ALGO_LABELS.get(a, a) for a in algorithms]
 
-    # Creer le graphique
-    fig, ax = plt.subplots(figsize=(10, 6))
+    has_memory = any(m > 0 for m in mems)
+
+    # Creer le graphique (temps + memoire cote a cote)
+    if has_memory:
+        fig, (ax, ax_mem) = plt.subplots(1, 2, figsize=(14, 6))
+    else:
+        fig, ax = plt.subplots(figsize=(10, 6))
+        ax_mem = None
 
     bars = ax.bar(labels, means, yerr=stds, capsize=5, color=colors, edgecolor='black')
 
     ax.set_xlabel('Algorithme', fontsize=12)
     ax.set_ylabel('Temps moyen (ms)', fontsize=12)
-    ax.set_title('Comparaison des algorithmes de labellisation\n(Moyenne sur toutes les images et connectivites)', fontsize=14)
+    ax.set_title('Temps d\'execution\n(Moyenne sur toutes les images et connectivites)', fontsize=14)
 
     # Ajouter les valeurs sur les barres
     for bar, mean, std in zip(bars, means, stds):
@@ -163,6 +181,24 @@ def graph_algorithm_comparison(results: List[ResultEntry], output_dir: str):
                     ha='center', va='bottom', fontsize=10)
 
     ax.grid(axis='y', linestyle='--', alpha=0.7)
+
+    if ax_mem is not None:
+        mem_bars = ax_mem.bar(labels, mems, color=colors, edgecolor='black')
+
+        ax_mem.set_xlabel('Algorithme', fontsize=12)
+        ax_mem.set_ylabel('Pic memoire (Ko)', fontsize=12)
+        ax_mem.set_title('Memoire de pointe (tracemalloc)\n(Moyenne sur toutes les images et connectivites)', fontsize=14)
+
+        for bar, mem in zip(mem_bars, mems):
+            height = bar.get_height()
+            ax_mem.annotate(f'{mem:.0f}Ko',
+                            xy=(bar.get_x() + bar.get_width() / 2, height),
+                            xytext=(0, 3),
+                            textcoords="offset points",
+                            ha='center', va='bottom', fontsize=10)
+
+        ax_mem.grid(axis='y', linestyle='--', alpha=0.7)
+
     plt.tight_layout()
 
     output_path = os.path.join(output_dir, 'comparison_algorithms.png')
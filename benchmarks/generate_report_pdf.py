@@ -237,8 +237,9 @@ def create_algorithms_section(pdf: RapportPDF):
         "et on note les equivalences entre etiquettes."
     )
     pdf.body_text(
-        "Deuxieme passe : On reparcourt l'image pour remplacer chaque etiquette "
-        "par son representant canonique (la plus petite etiquette equivalente)."
+        "Deuxieme passe : les equivalences sont resolues une seule fois dans une "
+        "table compacte, puis on reparcourt l'image pour remplacer chaque etiquette "
+        "via cette table (aucune resolution par pixel)."
     )
     pdf.body_text("Complexite : O(n) ou n est le nombre de pixels.")
 
@@ -6,15 +6,24 @@ Ce script:
 1. Execute le benchmark scientifique sur toutes les images
 2. Genere les graphiques automatiquement
 3. Cree un rapport texte recapitulatif
+4. Optionnellement, enregistre ou compare une baseline de performance
 
 Usage:
     python run_all.py [--runs N]
+    python run_all.py --save-baseline baseline.json
+    python run_all.py --compare baseline.json [--tolerance PCT]
+
+Le mode --compare reexecute le benchmark, compare chaque cas
+(algorithme, image, connectivite) au fichier de baseline avec la
+tolerance donnee (en %, defaut 10) et sort avec un code non nul en
+listant les cas qui ont regresse (temps ou memoire de pointe).
 
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
 
 import sys
 import os
+import json
 import subprocess
 from datetime import datetime
 
@@ -212,6 +221,118 @@ def generate_report(results, output_path: str, num_runs: int):
     print(f"  Rapport genere: {output_path}")
 
 
+def baseline_key(result) -> str:
+    """Cle unique d'un cas de benchmark (image, algorithme, connectivite)."""
+    return f"{result.image_name}|{result.algorithm}|{result.connectivity}"
+
+
+def save_baseline(results, output_path: str, num_runs: int):
+    """
+    Enregistre les resultats comme baseline de performance (JSON).
+
+    Args:
+        results: Resultats du benchmark (BenchmarkResult)
+        output_path: Chemin du fichier JSON
+        num_runs: Nombre de runs effectues
+    """
+    print_header("ENREGISTREMENT DE LA BASELINE")
+
+    data = {
+        'created': datetime.now().strftime('%Y-%m-%d %H:%M:%S'),
+        'num_runs': num_runs,
+        'cases': {
+            baseline_key(r): {
+                'mean_time_ms': round(r.mean_time, 4),
+                'std_time_ms': round(r.std_time, 4),
+                'peak_mem_kb': round(r.peak_mem_kb, 1),
+                'rss_delta_kb': round(r.rss_delta_kb, 1),
+                'num_components': r.num_components,
+            }
+            for r in results
+        },
+    }
+
+    parent = os.path.dirname(output_path)
+    if parent:
+        os.makedirs(parent, exist_ok=True)
+
+    with open(output_path, 'w', encoding='utf-8') as f:
+        json.dump(data, f, indent=2, sort_keys=True)
+
+    print(f"  Baseline enregistree: {output_path} ({len(data['cases'])} cas)")
+
+
+def compare_with_baseline(results, baseline_path: str,
+                          tolerance_pct: float) -> int:
+    """
+    Compare les resultats courants a une baseline enregistree.
+
+    Un cas regresse si son temps moyen ou son pic memoire depasse la
+    valeur de la baseline de plus de tolerance_pct pourcent, ou si le
+    nombre de composantes trouvees differe (regression de correction,
+    pas de performance).
+
+    Args:
+        results: Resultats du benchmark courant
+        baseline_path: Chemin du fichier JSON de baseline
+        tolerance_pct: Tolerance en pourcentage
+
+    Returns:
+        Nombre de cas en regression
+    """
+    print_header("COMPARAISON AVEC LA BASELINE")
+
+    with open(baseline_path, 'r', encoding='utf-8') as f:
+        baseline = json.load(f)
+
+    cases = baseline.get('cases', {})
+    print(f"  Baseline: {baseline_path}")
+    print(f"  Creee le: {baseline.get('created', 'inconnue')} "
+          f"({len(cases)} cas)")
+    print(f"  Tolerance: {tolerance_pct:.0f}%\n")
+
+    factor = 1.0 + tolerance_pct / 100.0
+    regressions = []
+    new_cases = 0
+
+    for r in results:
+        key = baseline_key(r)
+        base = cases.get(key)
+        if base is None:
+            new_cases += 1
+            continue
+
+        if r.num_components != base['num_components']:
+            regressions.append(
+                f"{key}: {r.num_components} composantes "
+                f"(baseline: {base['num_components']}) -- INCOHERENCE")
+            continue
+
+        if base['mean_time_ms'] > 0 and r.mean_time > base['mean_time_ms'] * factor:
+            regressions.append(
+                f"{key}: temps {r.mean_time:.2f} ms "
+                f"(baseline: {base['mean_time_ms']:.2f} ms, "
+                f"+{(r.mean_time / base['mean_time_ms'] - 1) * 100:.0f}%)")
+
+        if base['peak_mem_kb'] > 0 and r.peak_mem_kb > base['peak_mem_kb'] * factor:
+            regressions.append(
+                f"{key}: pic memoire {r.peak_mem_kb:.1f} Ko "
+                f"(baseline: {base['peak_mem_kb']:.1f} Ko, "
+                f"+{(r.peak_mem_kb / base['peak_mem_kb'] - 1) * 100:.0f}%)")
+
+    if new_cases:
+        print(f"  {new_cases} cas absents de la baseline (ignores)")
+
+    if regressions:
+        print(f"\n  {len(regressions)} REGRESSION(S) DETECTEE(S):\n")
+        for line in regressions:
+            print(f"    - {line}")
+    else:
+        print("\n  OK - Aucune regression detectee")
+
+    return len(regressions)
+
+
 def main():
     """Point d'entree principal."""
     import argparse
@@ -223,6 +344,13 @@ def main():
                         help='Nombre de runs par configuration (defaut: 10)')
     parser.add_argument('--input', type=str, default='images/input',
                         help='Repertoire des images (defaut: images/input)')
+    parser.add_argument('--save-baseline', type=str, metavar='FILE',
+                        help='Enregistre les resultats comme baseline JSON')
+    parser.add_argument('--compare', type=str, metavar='FILE',
+                        help='Compare les resultats a une baseline JSON '
+                             '(code de retour non nul en cas de regression)')
+    parser.add_argument('--tolerance', type=float, default=10.0,
+                        help='Tolerance de regression en %% (defaut: 10)')
 
     args = parser.parse_args()
 
@@ -264,13 +392,25 @@ def main():
     # Generer le rapport
     generate_report(results, report_path, args.runs)
 
+    # Gestion de la baseline de performance
+    if args.save_baseline:
+        save_baseline(results, args.save_baseline, args.runs)
+
+    num_regressions = 0
+    if args.compare:
+        if not os.path.exists(args.compare):
+            print(f"\n  ERREUR: baseline introuvable: {args.compare}")
+            return 1
+        num_regressions = compare_with_baseline(
+            results, args.compare, args.tolerance)
+
     print_header("BENCHMARK TERMINE")
     print(f"  Resultats CSV:  {csv_path}")
     print(f"  Graphiques:     {graphs_dir}/")
     print(f"  Rapport:        {report_path}")
     print("")
 
-    return 0
+    return 1 if num_regressions else 0
 
 
 if __name__ == "__main__":
@@ -31,7 +31,7 @@ from src.algorithms.two_pass import TwoPass
 from src.algorithms.union_find import UnionFind
 from src.algorithms.kruskal import Kruskal
 from src.algorithms.prim import Prim
-from src.utils.utils import Timer
+from src.utils.utils import Timer, measure_peak_memory
 
 
 # ============================================================================
@@ -113,6 +113,8 @@ class BenchmarkResult:
     num_components: int
     runs: int
     times: List[float] = field(default_factory=list)
+    peak_mem_kb: float = 0.0    # Pic d'allocations Python (Ko, tracemalloc)
+    rss_delta_kb: float = 0.0   # Croissance de la mémoire résidente (Ko)
 
     @property
     def mean_time(self) -> float:
@@ -260,7 +262,15 @@ class ScientificBenchmark:
                         break
 
                 if result.times:
+                    # Run dédié pour la mémoire (tracemalloc ralentit
+                    # l'exécution, donc hors des runs chronométrés)
+                    _, result.peak_mem_kb, result.rss_delta_kb = \
+                        measure_peak_memory(
+                            lambda: self.run_single_test(
+                                original_image, algo_name, connectivity))
+
                     print(f" {result.mean_time:8.2f} ms (+/- {result.std_time:6.2f}) "
+                          f"| pic {result.peak_mem_kb:8.1f} Ko "
                           f"| {result.num_components} comp.")
                     results.append(result)
 
@@ -325,7 +335,7 @@ class ScientificBenchmark:
             writer.writerow([
                 'image', 'algorithm', 'connectivity', 'runs',
                 'mean_time_ms', 'std_time_ms', 'min_time_ms', 'max_time_ms',
-                'num_components'
+                'peak_mem_kb', 'rss_delta_kb', 'num_components'
             ])
 
             # Donnees
@@ -334,6 +344,7 @@ class ScientificBenchmark:
                     r.image_name, r.algorithm, r.connectivity, r.runs,
                     f"{r.mean_time:.4f}", f"{r.std_time:.4f}",
                     f"{r.min_time:.4f}", f"{r.max_time:.4f}",
+                    f"{r.peak_mem_kb:.1f}", f"{r.rss_delta_kb:.1f}",
                     r.num_components
                 ])
 
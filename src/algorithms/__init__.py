@@ -3,5 +3,17 @@ from .two_pass import TwoPass
 from .union_find import UnionFind
 from .kruskal import Kruskal
 from .prim import Prim
+from .rle import RunLength
+from .incremental import IncrementalLabeler
+from .parallel import ParallelLabeler
+from .streaming import StreamingTwoPass
+from .volume import VolumeUnionFind
+from . import native
 
-__all__ = ["TwoPass", "UnionFind", "Kruskal", "Prim"]
+# Backend compilé (src/native/) sélectionné de façon transparente si
+# disponible ; les versions Python pures restent le repli.
+NATIVE_BACKEND = native.install(TwoPass, UnionFind, Kruskal, Prim)
+
+__all__ = ["TwoPass", "UnionFind", "Kruskal", "Prim", "RunLength",
+           "IncrementalLabeler", "ParallelLabeler", "StreamingTwoPass",
+           "VolumeUnionFind", "NATIVE_BACKEND"]
@@ -0,0 +1,175 @@
+"""
+Module algorithms/counters.py - Compteurs d'opérations des chemins chauds
+
+Surface d'instrumentation opt-in : quand le temps de labellisation
+explose sur une image, les compteurs révèlent COMBIEN d'opérations
+élémentaires elle a coûté (appels find/unite, fusions effectives,
+collisions d'équivalence, enfilages de spans), là où le chronomètre ne
+donne qu'un total opaque.
+
+ZÉRO SURCOÛT PAR DÉFAUT :
+
+L'instrumentation n'est jamais un `if` par pixel dans les boucles
+critiques. Elle est SÉLECTIONNÉE une fois à l'entrée des algorithmes :
+- les structures (DisjointSet, table d'équivalence) sont remplacées par
+  leurs sous-classes comptantes via la fabrique make_disjoint_set() —
+  les boucles appellent les mêmes méthodes liées, seul l'objet change
+- les boucles dupliquées (remplissage de spans de Prim) existent en
+  version comptante séparée, choisie à l'entrée de label()
+
+Quand les compteurs sont inactifs (le défaut), le chemin chaud exécute
+exactement le même code qu'avant.
+
+Usage :
+    counters.enable()
+    labels = TwoPass.label(image, 8)
+    for line in counters.active().summary_lines():
+        print(line)
+    counters.disable()
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+from typing import List, Optional
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from algorithms.disjoint_set import DisjointSet
+
+
+class OpCounters:
+    """
+    Compteurs d'opérations élémentaires d'une labellisation.
+
+    Attributs :
+        finds: Appels à find (y compris ceux internes à unite)
+        unites: Appels à unite
+        merges: Fusions effectives (unite retournant True)
+        collisions: Appels à unite sur deux labels déjà équivalents
+        make_sets: Créations de singletons (labels provisoires)
+        queue_pushes: Enfilages dans la file de spans (Prim)
+    """
+
+    __slots__ = ('finds', 'unites', 'merges', 'collisions',
+                 'make_sets', 'queue_pushes')
+
+    def __init__(self):
+        """Initialise tous les compteurs à zéro."""
+        self.reset()
+
+    def reset(self) -> None:
+        """Remet tous les compteurs à zéro."""
+        self.finds = 0
+        self.unites = 0
+        self.merges = 0
+        self.collisions = 0
+        self.make_sets = 0
+        self.queue_pushes = 0
+
+    def summary_lines(self) -> List[str]:
+        """
+        Retourne les compteurs formatés pour le résumé final.
+
+        Returns:
+            Liste de lignes prêtes à afficher
+        """
+        return [
+            f"Appels find            : {self.finds}",
+            f"Appels unite           : {self.unites}",
+            f"  dont fusions         : {self.merges}",
+            f"  dont collisions      : {self.collisions}",
+            f"Labels provisoires     : {self.make_sets}",
+            f"Spans enfiles (Prim)   : {self.queue_pushes}",
+        ]
+
+
+# Compteurs actifs du processus (None = instrumentation désactivée)
+_active: Optional[OpCounters] = None
+
+
+def enable() -> OpCounters:
+    """
+    Active l'instrumentation pour les prochaines labellisations.
+
+    Returns:
+        L'objet OpCounters qui accumulera les opérations
+    """
+    global _active
+    _active = OpCounters()
+    return _active
+
+
+def disable() -> None:
+    """Désactive l'instrumentation (retour au chemin chaud nu)."""
+    global _active
+    _active = None
+
+
+def active() -> Optional[OpCounters]:
+    """
+    Retourne les compteurs actifs, ou None si désactivés.
+
+    Les algorithmes interrogent cette fonction UNE FOIS à l'entrée de
+    label() pour sélectionner leur chemin (structures nues ou
+    instrumentées), jamais dans les boucles.
+    """
+    return _active
+
+
+class InstrumentedDisjointSet(DisjointSet):
+    """
+    Variante comptante de DisjointSet.
+
+    Chaque méthode incrémente les compteurs puis délègue à la version
+    nue. unite hérite du comptage des find qu'il effectue puisqu'il
+    passe par self.find (méthode redéfinie ici).
+    """
+
+    def __init__(self, size: int = 0, counters: OpCounters = None):
+        """
+        Constructeur.
+
+        Args:
+            size: Nombre d'éléments initial
+            counters: Compteurs à alimenter (défaut: compteurs actifs)
+        """
+        super().__init__(size)
+        self._counters = counters if counters is not None else _active
+
+    def make_set(self) -> int:
+        self._counters.make_sets += 1
+        return super().make_set()
+
+    def find(self, x: int) -> int:
+        self._counters.finds += 1
+        return super().find(x)
+
+    def unite(self, x: int, y: int) -> bool:
+        counters = self._counters
+        counters.unites += 1
+        merged = super().unite(x, y)
+        if merged:
+            counters.merges += 1
+        else:
+            counters.collisions += 1
+        return merged
+
+
+def make_disjoint_set(size: int = 0) -> DisjointSet:
+    """
+    Fabrique la structure Union-Find adaptée au mode courant.
+
+    Les algorithmes construisent leur DisjointSet via cette fabrique :
+    version nue quand l'instrumentation est inactive (aucun surcoût),
+    version comptante sinon.
+
+    Args:
+        size: Nombre d'éléments initial
+
+    Returns:
+        DisjointSet ou InstrumentedDisjointSet
+    """
+    if _active is None:
+        return DisjointSet(size)
+    return InstrumentedDisjointSet(size, _active)
@@ -0,0 +1,265 @@
+"""
+Module algorithms/incremental.py - Relabellisation incrémentale (vidéo)
+
+Moteur pour les flux caméra où les trames consécutives ne diffèrent que
+de quelques pourcents de pixels : au lieu de relabelliser chaque trame
+de zéro, seules les composantes touchées par le diff sont réparées.
+
+PRINCIPE :
+
+1. Diff : les deux trames binaires sont comparées ligne par ligne
+   (comparaison de tranches en C, les lignes identiques sont sautées)
+   pour produire l'ensemble des pixels changés
+2. Effacement : les pixels éteints perdent leur label
+3. Réparation : un parcours BFS sur la NOUVELLE trame est lancé depuis
+   chaque pixel allumé et depuis chaque voisin objet d'un pixel éteint.
+   Chaque parcours affecte un label frais à toute sa composante :
+   - un pixel allumé qui ponte deux anciennes composantes les fusionne
+     naturellement (le BFS les traverse toutes les deux)
+   - un pixel éteint qui coupe une composante la scinde naturellement
+     (chaque morceau restant est adjacent à un pixel éteint, donc
+     atteint par un des parcours, et reçoit son propre label frais)
+   Les labels affectés pendant la mise à jour courante servent de
+   marquage : un BFS ne retraverse jamais une zone déjà réparée
+
+Le coût par trame est proportionnel au diff plus à la taille des
+composantes touchées — pas à la résolution. Les composantes intactes
+conservent leur label d'une trame à l'autre (stabilité temporelle) ;
+les labels frais croissent de façon monotone.
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+from collections import deque
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from core.image import Image, LabelImage
+from algorithms.union_find import UnionFind
+
+
+class IncrementalLabeler:
+    """
+    Labellisation incrémentale trame à trame.
+
+    Utilisation :
+        labeler = IncrementalLabeler(connectivity=4)
+        labels = labeler.reset(first_frame)     # labellisation complète
+        labels = labeler.update(next_frame)     # réparation du diff
+        ...
+
+    L'image de labels interne est mise à jour en place et retournée à
+    chaque appel (ne pas la modifier côté appelant).
+    """
+
+    def __init__(self, connectivity: int = 4):
+        """
+        Constructeur.
+
+        Args:
+            connectivity: Type de connectivité (4 ou 8)
+        """
+        self._connectivity = connectivity
+        self._frame = None
+        self._labels = None
+        self._next_label = 1
+
+    def reset(self, frame: Image) -> LabelImage:
+        """
+        (Re)démarre le flux avec une labellisation complète.
+
+        Args:
+            frame: Première trame binaire (0 = fond, 255 = objet)
+
+        Returns:
+            Image labellisée
+        """
+        self._labels = UnionFind.label(frame, self._connectivity)
+        self._frame = frame.copy()
+        self._next_label = max(self._labels.buffer, default=0) + 1
+        return self._labels
+
+    def update(self, frame: Image) -> LabelImage:
+        """
+        Répare la labellisation pour la nouvelle trame.
+
+        Args:
+            frame: Nouvelle trame binaire, mêmes dimensions
+
+        Returns:
+            Image labellisée (mise à jour en place)
+        """
+        if self._labels is None:
+            return self.reset(frame)
+        if (frame.width != self._frame.width
+                or frame.height != self._frame.height):
+            raise ValueError("Dimensions de trame incompatibles")
+
+        self._next_label = IncrementalLabeler._repair(
+            self._frame, self._labels, frame,
+            self._connectivity, self._next_label)
+
+        # Les labels ont changé : invalider le compte mis en cache
+        self._labels.num_components = None
+
+        self._frame.copy_from(frame)
+        return self._labels
+
+    @staticmethod
+    def relabel(prev_frame: Image, prev_labels: LabelImage,
+                new_frame: Image, connectivity: int = 4) -> LabelImage:
+        """
+        API sans état : répare une labellisation existante.
+
+        Args:
+            prev_frame: Trame binaire précédente
+            prev_labels: Labellisation de la trame précédente
+                         (non modifiée)
+            new_frame: Nouvelle trame binaire
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Nouvelle LabelImage réparée
+
+        Note: contrairement à la version avec état, cette variante doit
+        copier les labels et retrouver le plus grand label existant,
+        deux opérations O(N). Préférer IncrementalLabeler en continu.
+        """
+        labels = LabelImage(prev_labels.width, prev_labels.height)
+        memoryview(labels.buffer)[:] = memoryview(prev_labels.buffer)
+        next_label = max(labels.buffer, default=0) + 1
+
+        IncrementalLabeler._repair(prev_frame, labels, new_frame,
+                                   connectivity, next_label)
+        return labels
+
+    @staticmethod
+    def _repair(prev_frame: Image, labels: LabelImage, new_frame: Image,
+                connectivity: int, next_label: int) -> int:
+        """
+        Répare l'image de labels en place pour la nouvelle trame.
+
+        Args:
+            prev_frame: Trame précédente
+            labels: Image de labels (entrée/sortie)
+            new_frame: Nouvelle trame
+            connectivity: Connectivité (4 ou 8)
+            next_label: Premier label frais disponible
+
+        Returns:
+            Prochain label frais après réparation
+        """
+        width = new_frame.width
+        height = new_frame.height
+        prev_buf = memoryview(prev_frame.buffer)
+        new_buf = memoryview(new_frame.buffer)
+        label_buf = labels.buffer
+
+        # Les labels >= threshold ont été affectés pendant cette mise à
+        # jour : zone déjà réparée, les BFS s'y arrêtent
+        threshold = next_label
+
+        # Étape 1 : diff ligne par ligne (lignes identiques sautées)
+        changed = []
+        for x in range(height):
+            start = x * width
+            end = start + width
+            if prev_buf[start:end] == new_buf[start:end]:
+                continue
+            for i in range(start, end):
+                if prev_buf[i] != new_buf[i]:
+                    changed.append(i)
+
+        # Étape 2 : les pixels éteints perdent leur label
+        for i in changed:
+            if new_buf[i] == 0:
+                label_buf[i] = 0
+
+        # Étape 3 : réparation par BFS depuis les pixels du diff
+        for i in changed:
+            if new_buf[i] != 0:
+                # Pixel allumé : sa composante (fusion possible)
+                if label_buf[i] < threshold:
+                    next_label = IncrementalLabeler._flood(
+                        new_buf, label_buf, width, height, i,
+                        next_label, threshold, connectivity)
+            else:
+                # Pixel éteint : chaque morceau restant de son ancienne
+                # composante (scission possible)
+                for n in IncrementalLabeler._neighbor_indices(
+                        i, width, height, connectivity):
+                    if new_buf[n] != 0 and 0 < label_buf[n] < threshold:
+                        next_label = IncrementalLabeler._flood(
+                            new_buf, label_buf, width, height, n,
+                            next_label, threshold, connectivity)
+
+        return next_label
+
+    @staticmethod
+    def _flood(new_buf, label_buf, width: int, height: int, start: int,
+               next_label: int, threshold: int, connectivity: int) -> int:
+        """
+        Affecte un label frais à toute la composante contenant start.
+
+        Ne retraverse jamais les pixels déjà réparés pendant cette mise
+        à jour (label >= threshold).
+
+        Returns:
+            Prochain label frais
+        """
+        label = next_label
+        queue = deque()
+        queue.append(start)
+        label_buf[start] = label
+
+        while queue:
+            i = queue.popleft()
+            for n in IncrementalLabeler._neighbor_indices(
+                    i, width, height, connectivity):
+                if new_buf[n] != 0 and label_buf[n] != label:
+                    if label_buf[n] < threshold:
+                        label_buf[n] = label
+                        queue.append(n)
+
+        return next_label + 1
+
+    @staticmethod
+    def _neighbor_indices(i: int, width: int, height: int,
+                          connectivity: int):
+        """
+        Retourne les index plats des voisins d'un pixel.
+
+        Args:
+            i: Index plat du pixel
+            width: Largeur de l'image
+            height: Hauteur de l'image
+            connectivity: Connectivité (4 ou 8)
+
+        Returns:
+            Liste des index voisins
+        """
+        x = i // width
+        y = i - x * width
+        neighbors = []
+
+        if x > 0:
+            neighbors.append(i - width)
+        if x < height - 1:
+            neighbors.append(i + width)
+        if y > 0:
+            neighbors.append(i - 1)
+        if y < width - 1:
+            neighbors.append(i + 1)
+
+        if connectivity == 8:
+            if x > 0 and y > 0:
+                neighbors.append(i - width - 1)
+            if x > 0 and y < width - 1:
+                neighbors.append(i - width + 1)
+            if x < height - 1 and y > 0:
+                neighbors.append(i + width - 1)
+            if x < height - 1 and y < width - 1:
+                neighbors.append(i + width + 1)
+
+        return neighbors
@@ -27,10 +27,21 @@ Pour la labellisation, on adapte Kruskal :
 - On construit une FORÊT COUVRANTE (pas un seul arbre)
 - Chaque arbre de la forêt = une composante connexe
 
+MODE FLUX (par défaut) :
+
+Comme toutes les arêtes ont le même poids, le tri est un no-op : tout
+ordre de consommation produit la même forêt. Le mode par défaut fusionne
+donc chaque paire adjacente directement dans la structure Union-Find au
+fil du balayage, sans jamais matérialiser d'objet Edge — la mémoire
+passe de O(E) aux seuls tableaux Union-Find. La liste triée d'arêtes
+reste disponible via materialize_edges=True pour le cas pédagogique
+pondéré.
+
 COMPLEXITÉ :
-- Temps: O(E log E) pour le tri des arêtes
+- Temps: O(E * alpha(N)) en mode flux,
+  O(E log E) avec la liste triée (materialize_edges=True)
   où E = nombre d'arêtes ≈ 2N pour connectivité 4, ≈ 4N pour connectivité 8
-- Espace: O(E + V) pour stocker le graphe
+- Espace: O(V) en mode flux, O(E + V) avec la liste triée
 
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
@@ -42,6 +53,8 @@ from dataclasses import dataclass
 
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from core.image import Image, LabelImage
+from algorithms.counters import make_disjoint_set
+from algorithms.scan import unite_adjacent
 
 
 @dataclass
@@ -58,66 +71,6 @@ class Edge:
         return self.weight < other.weight
 
 
-class DisjointSetKruskal:
-    """
-    Structure Union-Find pour Kruskal.
-
-    Identique à celle utilisée dans union_find.py
-    (on la garde ici pour que chaque algorithme soit autonome)
-    """
-
-    def __init__(self, size: int):
-        """
-        Constructeur.
-
-        Args:
-            size: Nombre d'éléments
-        """
-        self._parent = list(range(size))
-        self._rank = [0] * size
-
-    def find(self, x: int) -> int:
-        """
-        Trouve le représentant de l'ensemble contenant x.
-
-        Args:
-            x: Élément
-
-        Returns:
-            Représentant (racine) de l'ensemble
-        """
-        if self._parent[x] != x:
-            self._parent[x] = self.find(self._parent[x])
-        return self._parent[x]
-
-    def unite(self, x: int, y: int) -> bool:
-        """
-        Fusionne les ensembles contenant x et y.
-
-        Args:
-            x: Premier élément
-            y: Deuxième élément
-
-        Returns:
-            True si fusion effectuée, False si déjà dans le même ensemble
-        """
-        root_x = self.find(x)
-        root_y = self.find(y)
-
-        if root_x == root_y:
-            return False
-
-        if self._rank[root_x] < self._rank[root_y]:
-            self._parent[root_x] = root_y
-        elif self._rank[root_x] > self._rank[root_y]:
-            self._parent[root_y] = root_x
-        else:
-            self._parent[root_y] = root_x
-            self._rank[root_x] += 1
-
-        return True
-
-
 class Kruskal:
     """
     Algorithme de Kruskal pour la labellisation.
@@ -129,13 +82,19 @@ class Kruskal:
     """
 
     @staticmethod
-    def label(input_image: Image, connectivity: int = 4) -> LabelImage:
+    def label(input_image: Image, connectivity: int = 4,
+              materialize_edges: bool = False) -> LabelImage:
         """
         Labellise les composantes connexes d'une image binaire.
 
         Args:
             input_image: Image binaire (0 = fond, 255 = objet)
             connectivity: Type de connectivité (4 ou 8)
+            materialize_edges: Si True, construit et trie la liste
+                               d'arêtes explicite (fidèle au Kruskal
+                               pondéré classique) ; sinon les paires
+                               adjacentes sont fusionnées au fil du
+                               balayage sans objets Edge
 
         Returns:
             Image labellisée avec les composantes connexes
@@ -147,20 +106,27 @@ class Kruskal:
         labels = LabelImage(width, height)
         labels.fill(0)
 
-        """
-        Étape 1-2 : Construction et tri des arêtes
-        Note: toutes les arêtes ont poids=1, le tri est symbolique
-        mais fidèle à l'algorithme de Kruskal classique.
-        """
-        edges = Kruskal._build_edges(input_image, connectivity)
-        edges.sort()
-
-        """
-        Étape 3 : Kruskal - fusion des composantes via Union-Find
-        """
-        ds = DisjointSetKruskal(size)
-        for edge in edges:
-            ds.unite(edge.u, edge.v)
+        ds = make_disjoint_set(size)
+
+        if materialize_edges:
+            """
+            Étapes 1-3 (mode pédagogique) : construction, tri puis
+            consommation de la liste d'arêtes explicite.
+            Note: toutes les arêtes ont poids=1, le tri est symbolique
+            mais fidèle à l'algorithme de Kruskal classique.
+            """
+            edges = Kruskal._build_edges(input_image, connectivity)
+            edges.sort()
+            for edge in edges:
+                ds.unite(edge.u, edge.v)
+        else:
+            """
+            Étapes 1-3 (mode flux) : les arêtes sont consommées au fil
+            du balayage (boucles spécialisées de algorithms/scan.py).
+            À poids égaux, l'ordre est indifférent : la forêt obtenue
+            est identique à celle de la liste triée.
+            """
+            unite_adjacent(input_image, ds, connectivity)
 
         """
         Étape 4 : Labellisation - remapper en labels compacts
@@ -183,8 +149,29 @@ class Kruskal:
 
                 labels.set_at(x, y, root_to_label[root])
 
+        labels.num_components = next_label - 1
+
         return labels
 
+    @staticmethod
+    def label_with_stats(input_image: Image, connectivity: int = 4):
+        """
+        Labellise et calcule les statistiques par composante (aire,
+        boîte englobante, centroïde) en une seule passe supplémentaire
+        sur l'image de labels.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Tuple (LabelImage, ComponentStats)
+        """
+        from algorithms.stats import ComponentStats
+
+        labels = Kruskal.label(input_image, connectivity)
+        return labels, ComponentStats.from_label_image(labels)
+
     @staticmethod
     def _build_edges(input_image: Image, connectivity: int) -> List[Edge]:
         """
@@ -0,0 +1,99 @@
+"""
+Module algorithms/native.py - Sélection du backend compilé (optionnel)
+
+Le module C _labeling (voir src/native/) implémente les boucles par pixel
+des quatre algorithmes directement sur les tampons plats de core/image.py.
+Ce module détecte sa présence et fournit des fonctions `label()` de même
+signature que les versions Python, qui écrivent dans une LabelImage
+standard.
+
+Sélection :
+- algorithms/__init__.py substitue les noyaux natifs aux versions Python
+  au moment de l'import si le module compilé est disponible
+- la variable d'environnement LABELLISATION_NO_NATIVE=1 force les
+  versions Python pures (utile pour mesurer le speedup avec
+  benchmarks/benchmark.py)
+- toute connectivité autre que 4 ou 8 est déléguée à la version Python
+
+Compilation du backend : cd src/native && python setup.py build_ext --inplace
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from core.image import Image, LabelImage
+from algorithms.counters import active as counters_active
+
+_NATIVE_DIR = os.path.join(
+    os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'native')
+
+_labeling = None
+if os.environ.get("LABELLISATION_NO_NATIVE") != "1":
+    if _NATIVE_DIR not in sys.path:
+        sys.path.insert(0, _NATIVE_DIR)
+    try:
+        import _labeling
+    except ImportError:
+        _labeling = None
+
+AVAILABLE = _labeling is not None
+
+
+def _make_label(kernel_name: str, python_fallback):
+    """
+    Construit une fonction label() adossée à un noyau natif.
+
+    Args:
+        kernel_name: Nom du noyau dans _labeling ("label_compact")
+        python_fallback: Version Python pure, utilisée pour les
+                         connectivités non gérées par le noyau
+
+    Returns:
+        Fonction label(input_image, connectivity) -> LabelImage
+    """
+    kernel = getattr(_labeling, kernel_name)
+
+    def label(input_image: Image, connectivity: int = 4,
+              **kwargs) -> LabelImage:
+        # Les compteurs d'opérations ne voient que le chemin Python :
+        # quand ils sont actifs, le noyau natif s'efface. Idem pour les
+        # options propres aux versions Python (ex. materialize_edges
+        # de Kruskal), que le noyau ne connaît pas
+        if connectivity not in (4, 8) or kwargs \
+                or counters_active() is not None:
+            return python_fallback(input_image, connectivity, **kwargs)
+
+        labels = LabelImage(input_image.width, input_image.height)
+        labels.num_components = kernel(
+            input_image.buffer, labels.buffer,
+            input_image.width, input_image.height, connectivity)
+        return labels
+
+    label.__doc__ = python_fallback.__doc__
+    return label
+
+
+def install(two_pass_cls, union_find_cls, kruskal_cls, prim_cls) -> bool:
+    """
+    Substitue les noyaux natifs aux méthodes label() des quatre classes.
+
+    Les versions Python restent accessibles (et servent de repli pour les
+    connectivités non standard). Sans effet si le module compilé est
+    absent.
+
+    Returns:
+        True si le backend natif a été installé
+    """
+    if not AVAILABLE:
+        return False
+
+    # Depuis que la deuxième passe de TwoPass renumérote en ordre de
+    # parcours, les quatre algorithmes partagent la même numérotation
+    # compacte : un seul noyau suffit
+    for cls in (two_pass_cls, union_find_cls, kruskal_cls, prim_cls):
+        cls.label = staticmethod(_make_label("label_compact", cls.label))
+
+    return True
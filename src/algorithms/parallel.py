@@ -0,0 +1,301 @@
+"""
+Module algorithms/parallel.py - Labellisation parallèle par tuiles
+
+Moteur de labellisation multi-cœurs qui enveloppe n'importe lequel des
+algorithmes existants comme noyau par tuile.
+
+PRINCIPE :
+
+1. Découpage : l'image est divisée en bandes horizontales contiguës
+   (une par worker)
+2. Labellisation locale : chaque bande est labellisée indépendamment
+   par l'algorithme de base dans un pool de processus. Les pixels et
+   les labels vivent dans des segments de mémoire partagée
+   (multiprocessing.shared_memory), les tuiles ne sont donc jamais
+   picklées
+3. Décalage : les labels locaux de chaque bande sont décalés pour être
+   globalement uniques (préfixe cumulé des maxima par bande)
+4. Fusion des coutures : pour chaque frontière entre deux bandes, les
+   labels adjacents (selon la connectivité) sont fusionnés dans la
+   structure DisjointSet partagée — travail en O(width * nb_bandes)
+5. Compactage : une table de correspondance label global -> label
+   compact (1, 2, 3...) est construite puis appliquée en parallèle
+   par bande
+
+Les labels finaux sont compacts et cohérents sur toute l'image ; leur
+numérotation peut différer de celle de l'algorithme séquentiel, mais le
+nombre de composantes est identique.
+
+Sélection depuis main.py : algorithm=parallel:<base_algo>
+(ex. parallel:two_pass, parallel:union_find)
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+from array import array
+from multiprocessing import Pool, shared_memory, cpu_count
+from typing import List, Tuple
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from core.image import Image, LabelImage
+from algorithms.disjoint_set import DisjointSet
+from algorithms.two_pass import TwoPass
+from algorithms.union_find import UnionFind
+from algorithms.kruskal import Kruskal
+from algorithms.prim import Prim
+from algorithms.rle import RunLength
+
+# Algorithmes utilisables comme noyau par tuile
+BASE_ALGORITHMS = {
+    "two_pass": TwoPass,
+    "union_find": UnionFind,
+    "kruskal": Kruskal,
+    "prim": Prim,
+    "rle": RunLength,
+}
+
+# État par worker (initialisé une fois par processus, jamais picklé ensuite)
+_worker = {}
+
+
+def _init_worker(in_name: str, out_name: str, lut_name: str,
+                 width: int, connectivity: int, base_name: str) -> None:
+    """Attache les segments partagés dans le processus worker."""
+    _worker["in"] = shared_memory.SharedMemory(name=in_name)
+    _worker["out"] = shared_memory.SharedMemory(name=out_name)
+    _worker["lut"] = shared_memory.SharedMemory(name=lut_name)
+    _worker["width"] = width
+    _worker["connectivity"] = connectivity
+    _worker["label"] = BASE_ALGORITHMS[base_name].label
+
+
+def _label_tile(tile: Tuple[int, int]) -> int:
+    """
+    Labellise une bande [row_start, row_end) avec l'algorithme de base.
+
+    La bande adopte une vue sans copie sur le segment d'entrée partagé ;
+    les labels locaux sont écrits dans le segment de sortie partagé.
+
+    Returns:
+        Plus grand label local utilisé dans la bande
+    """
+    row_start, row_end = tile
+    width = _worker["width"]
+
+    view = memoryview(_worker["in"].buf)[row_start * width:row_end * width]
+    band = Image(0, 0)
+    band.adopt_buffer(view, width, row_end - row_start)
+
+    labels = _worker["label"](band, _worker["connectivity"])
+
+    out = memoryview(_worker["out"].buf).cast('i')
+    out[row_start * width:row_end * width] = memoryview(labels.buffer)
+
+    return max(labels.buffer, default=0)
+
+
+def _offset_and_mark(args: Tuple[int, int, int]) -> None:
+    """
+    Décale les labels d'une bande pour les rendre globalement uniques
+    et marque dans la table partagée les labels réellement utilisés.
+    """
+    row_start, row_end, offset = args
+    width = _worker["width"]
+    out = memoryview(_worker["out"].buf).cast('i')
+    lut = memoryview(_worker["lut"].buf).cast('i')
+
+    for i in range(row_start * width, row_end * width):
+        value = out[i]
+        if value != 0:
+            value += offset
+            out[i] = value
+            lut[value] = 1
+
+
+def _remap_tile(tile: Tuple[int, int]) -> None:
+    """Applique la table label global -> label compact sur une bande."""
+    row_start, row_end = tile
+    width = _worker["width"]
+    out = memoryview(_worker["out"].buf).cast('i')
+    lut = memoryview(_worker["lut"].buf).cast('i')
+
+    for i in range(row_start * width, row_end * width):
+        value = out[i]
+        if value != 0:
+            out[i] = lut[value]
+
+
+class ParallelLabeler:
+    """
+    Moteur de labellisation parallèle par bandes horizontales.
+
+    Enveloppe un des algorithmes existants comme noyau par tuile et
+    résout les équivalences inter-tuiles le long des coutures.
+    """
+
+    def __init__(self, base_algorithm: str = "two_pass", num_workers: int = 0):
+        """
+        Constructeur.
+
+        Args:
+            base_algorithm: Nom du noyau par tuile
+                            (two_pass | union_find | kruskal | prim)
+            num_workers: Nombre de processus (0 = nombre de cœurs)
+        """
+        if base_algorithm not in BASE_ALGORITHMS:
+            raise ValueError(f"Algorithme de base inconnu: {base_algorithm}")
+        self._base_algorithm = base_algorithm
+        self._num_workers = num_workers if num_workers > 0 else cpu_count()
+
+    def label(self, input_image: Image, connectivity: int = 4) -> LabelImage:
+        """
+        Labellise les composantes connexes d'une image binaire.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Image labellisée avec les composantes connexes
+        """
+        width = input_image.width
+        height = input_image.height
+        size = width * height
+
+        num_workers = min(self._num_workers, max(1, height // 2))
+        if num_workers <= 1 or size == 0:
+            # Image trop petite pour amortir le coût du pool
+            return BASE_ALGORITHMS[self._base_algorithm].label(
+                input_image, connectivity)
+
+        # Segments partagés : pixels (1 octet), labels (4 octets),
+        # table de remappage (4 octets par label possible)
+        shm_in = shared_memory.SharedMemory(create=True, size=size)
+        shm_out = shared_memory.SharedMemory(create=True, size=size * 4)
+        shm_lut = shared_memory.SharedMemory(create=True, size=(size + 1) * 4)
+
+        try:
+            shm_in.buf[:size] = input_image.buffer
+
+            tiles = self._make_tiles(height, num_workers)
+
+            with Pool(processes=num_workers,
+                      initializer=_init_worker,
+                      initargs=(shm_in.name, shm_out.name, shm_lut.name,
+                                width, connectivity,
+                                self._base_algorithm)) as pool:
+
+                # Phase 1 : labellisation locale de chaque bande
+                max_labels = pool.map(_label_tile, tiles)
+
+                # Phase 2 : décalage des labels (préfixe cumulé) + marquage
+                offsets = []
+                total = 0
+                for max_label in max_labels:
+                    offsets.append(total)
+                    total += max_label
+
+                pool.map(_offset_and_mark,
+                         [(start, end, offsets[i])
+                          for i, (start, end) in enumerate(tiles)])
+
+                # Phase 3 : fusion des équivalences le long des coutures
+                ds = self._merge_seams(shm_in, shm_out, tiles, width,
+                                       connectivity, total)
+
+                # Phase 4 : table label global -> label compact
+                num_components = self._build_compact_lut(shm_lut, ds, total)
+
+                # Phase 5 : remappage final en parallèle
+                pool.map(_remap_tile, tiles)
+
+            result = LabelImage(width, height)
+            memoryview(result.buffer)[:] = \
+                memoryview(shm_out.buf).cast('i')[:size]
+            result.num_components = num_components
+            return result
+
+        finally:
+            shm_in.close()
+            shm_in.unlink()
+            shm_out.close()
+            shm_out.unlink()
+            shm_lut.close()
+            shm_lut.unlink()
+
+    @staticmethod
+    def _make_tiles(height: int, num_workers: int) -> List[Tuple[int, int]]:
+        """
+        Découpe les lignes en bandes contiguës quasi égales.
+
+        Returns:
+            Liste de (row_start, row_end) par bande
+        """
+        tiles = []
+        base = height // num_workers
+        extra = height % num_workers
+        row = 0
+        for i in range(num_workers):
+            rows = base + (1 if i < extra else 0)
+            tiles.append((row, row + rows))
+            row += rows
+        return tiles
+
+    @staticmethod
+    def _merge_seams(shm_in, shm_out, tiles: List[Tuple[int, int]],
+                     width: int, connectivity: int, total: int) -> DisjointSet:
+        """
+        Fusionne les labels adjacents de part et d'autre de chaque
+        frontière entre bandes.
+
+        Returns:
+            DisjointSet sur les labels globaux [0, total]
+        """
+        pixels = shm_in.buf
+        labels = memoryview(shm_out.buf).cast('i')
+        ds = DisjointSet(total + 1)
+
+        for start, end in tiles[:-1]:
+            upper = (end - 1) * width
+            lower = end * width
+
+            for y in range(width):
+                if pixels[lower + y] == 0:
+                    continue
+                if pixels[upper + y] != 0:
+                    ds.unite(labels[upper + y], labels[lower + y])
+                if connectivity == 8:
+                    if y > 0 and pixels[upper + y - 1] != 0:
+                        ds.unite(labels[upper + y - 1], labels[lower + y])
+                    if y < width - 1 and pixels[upper + y + 1] != 0:
+                        ds.unite(labels[upper + y + 1], labels[lower + y])
+
+        return ds
+
+    @staticmethod
+    def _build_compact_lut(shm_lut, ds: DisjointSet, total: int) -> int:
+        """
+        Transforme les marques d'utilisation de la table partagée en
+        correspondance label global -> label compact (1, 2, 3...).
+
+        Returns:
+            Nombre de labels compacts affectés (= nombre de composantes)
+        """
+        lut = memoryview(shm_lut.buf).cast('i')
+        root_to_compact = {}
+        next_label = 1
+
+        for label in range(1, total + 1):
+            if lut[label] == 0:
+                continue
+            root = ds.find(label)
+            compact = root_to_compact.get(root)
+            if compact is None:
+                compact = next_label
+                next_label += 1
+                root_to_compact[root] = compact
+            lut[label] = compact
+
+        return next_label - 1
@@ -26,27 +26,35 @@ Pour la labellisation, on adapte Prim :
 
 IMPLÉMENTATION :
 
-On utilise une approche BFS (Breadth-First Search) / DFS (Depth-First Search)
-simplifiée au lieu de Prim avec file de priorité, car :
+On utilise un remplissage par spans (scanline fill) au lieu de Prim avec
+file de priorité, car :
 - Toutes les arêtes ont le même poids (pas besoin de file de priorité)
-- BFS/DFS explore exactement la même composante connexe que Prim
-- Plus simple et plus efficace
+- Le remplissage explore exactement la même composante connexe que Prim
+- La file contient des spans horizontaux (ligne, y_début, y_fin) et non
+  des pixels : chaque span est peint d'un bloc par copie de tranche sur
+  le tampon plat, et seules les lignes au-dessus/au-dessous sont
+  balayées pour découvrir de nouveaux spans. Le trafic de file passe de
+  par-pixel à par-run
+Les variantes BFS et DFS par pixel sont conservées comme références
+pédagogiques (_bfs, _dfs) mais ne sont plus utilisées par défaut.
 
 COMPLEXITÉ :
 - Temps: O(N) où N est le nombre de pixels
-  (chaque pixel est visité une seule fois)
-- Espace: O(N) pour la file (dans le pire cas)
+  (chaque pixel est visité un nombre borné de fois)
+- Espace: O(R) pour la file, R = nombre de runs (dans le pire cas)
 
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
 
 import sys
 import os
+from array import array
 from typing import List, Tuple
 from collections import deque
 
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from core.image import Image, LabelImage
+from algorithms.counters import active as counters_active
 from utils.utils import get_neighbors
 
 
@@ -81,6 +89,11 @@ class Prim:
         labels.fill(0)
         current_label = 0
 
+        # Remplissage nu par défaut, variante comptante si les compteurs
+        # d'opérations sont actifs — sélection une fois, pas par pixel
+        ctr = counters_active()
+        fill = Prim._fill_spans if ctr is None else Prim._fill_spans_counted
+
         """
         Parcours de l'image : pour chaque pixel objet non labellisé,
         lancer un BFS pour explorer toute sa composante connexe.
@@ -89,10 +102,168 @@ class Prim:
             for y in range(width):
                 if input_image.at(x, y) != 0 and labels.at(x, y) == 0:
                     current_label += 1
-                    Prim._bfs(input_image, labels, x, y, current_label, connectivity)
+                    fill(input_image, labels, x, y,
+                         current_label, connectivity)
+
+        labels.num_components = current_label
 
         return labels
 
+    @staticmethod
+    def label_with_stats(input_image: Image, connectivity: int = 4):
+        """
+        Labellise et calcule les statistiques par composante (aire,
+        boîte englobante, centroïde) en une seule passe supplémentaire
+        sur l'image de labels.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Tuple (LabelImage, ComponentStats)
+        """
+        from algorithms.stats import ComponentStats
+
+        labels = Prim.label(input_image, connectivity)
+        return labels, ComponentStats.from_label_image(labels)
+
+    @staticmethod
+    def _fill_spans(input_image: Image, labels: LabelImage,
+                    start_x: int, start_y: int, label: int,
+                    connectivity: int) -> None:
+        """
+        Explore une composante connexe par remplissage de spans.
+
+        La file contient des spans horizontaux (ligne, y_début, y_fin)
+        déjà peints. Pour chaque span défilé, seules les lignes
+        au-dessus et au-dessous sont balayées (élargies d'une colonne de
+        chaque côté en 8-connectivité) : chaque run objet non labellisé
+        y est peint entièrement d'une copie de tranche puis enfilé.
+
+        Un run entier n'est peint qu'une fois (un pixel labellisé
+        implique que tout son run l'est), donc chaque pixel n'entre
+        jamais dans la file — seuls les runs y passent.
+
+        Args:
+            input_image: Image binaire
+            labels: Image de labels (modifiée)
+            start_x: Coordonnée ligne de départ
+            start_y: Coordonnée colonne de départ
+            label: Label à affecter
+            connectivity: Connectivité (4 ou 8)
+        """
+        width = input_image.width
+        height = input_image.height
+        img = input_image.buffer
+        out = labels.buffer
+        reach = 1 if connectivity == 8 else 0
+
+        start, end = Prim._paint_run(img, out, width, start_x, start_y, label)
+        queue = deque()
+        queue.append((start_x, start, end))
+
+        while queue:
+            x, start, end = queue.popleft()
+
+            # Fenêtre de balayage des lignes adjacentes
+            lo = start - reach if start > reach else 0
+            hi = end + reach if end + reach < width else width
+
+            for xr in (x - 1, x + 1):
+                if xr < 0 or xr >= height:
+                    continue
+                base = xr * width
+                y = lo
+                while y < hi:
+                    if img[base + y] != 0 and out[base + y] == 0:
+                        run_start, run_end = Prim._paint_run(
+                            img, out, width, xr, y, label)
+                        queue.append((xr, run_start, run_end))
+                        y = run_end
+                    else:
+                        y += 1
+
+    @staticmethod
+    def _fill_spans_counted(input_image: Image, labels: LabelImage,
+                            start_x: int, start_y: int, label: int,
+                            connectivity: int) -> None:
+        """
+        Double comptant de _fill_spans : même algorithme, mais chaque
+        enfilage de span incrémente les compteurs d'opérations actifs.
+
+        Maintenu en copie séparée pour que le chemin non instrumenté ne
+        paie aucun test (voir algorithms/counters.py).
+
+        Args:
+            input_image: Image binaire
+            labels: Image de labels (modifiée)
+            start_x: Coordonnée ligne de départ
+            start_y: Coordonnée colonne de départ
+            label: Label à affecter
+            connectivity: Connectivité (4 ou 8)
+        """
+        ctr = counters_active()
+        width = input_image.width
+        height = input_image.height
+        img = input_image.buffer
+        out = labels.buffer
+        reach = 1 if connectivity == 8 else 0
+
+        start, end = Prim._paint_run(img, out, width, start_x, start_y, label)
+        queue = deque()
+        queue.append((start_x, start, end))
+        ctr.queue_pushes += 1
+
+        while queue:
+            x, start, end = queue.popleft()
+
+            lo = start - reach if start > reach else 0
+            hi = end + reach if end + reach < width else width
+
+            for xr in (x - 1, x + 1):
+                if xr < 0 or xr >= height:
+                    continue
+                base = xr * width
+                y = lo
+                while y < hi:
+                    if img[base + y] != 0 and out[base + y] == 0:
+                        run_start, run_end = Prim._paint_run(
+                            img, out, width, xr, y, label)
+                        queue.append((xr, run_start, run_end))
+                        ctr.queue_pushes += 1
+                        y = run_end
+                    else:
+                        y += 1
+
+    @staticmethod
+    def _paint_run(img, out, width: int, x: int, y: int,
+                   label: int) -> Tuple[int, int]:
+        """
+        Peint le run horizontal maximal contenant (x, y) d'un bloc.
+
+        Args:
+            img: Tampon plat de l'image binaire
+            out: Tampon plat des labels
+            width: Largeur de l'image
+            x: Coordonnée ligne
+            y: Colonne d'un pixel objet du run
+            label: Label à affecter
+
+        Returns:
+            Tuple (y_début, y_fin) du run, y_fin exclus
+        """
+        base = x * width
+        start = y
+        while start > 0 and img[base + start - 1] != 0:
+            start -= 1
+        end = y + 1
+        while end < width and img[base + end] != 0:
+            end += 1
+
+        out[base + start:base + end] = array('i', [label]) * (end - start)
+        return start, end
+
     @staticmethod
     def _bfs(input_image: Image, labels: LabelImage,
              start_x: int, start_y: int, label: int, connectivity: int) -> None:
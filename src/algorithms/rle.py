@@ -0,0 +1,225 @@
+"""
+Module algorithms/rle.py - Labellisation par runs (Run-Length Encoding)
+
+Cinquième algorithme, adapté aux images dominées par de longues plages
+horizontales (documents scannés : encre et fond).
+
+PRINCIPE :
+
+Au lieu de traiter chaque pixel individuellement, l'image est d'abord
+compressée en runs — les plages horizontales maximales de pixels
+"objet" de chaque ligne :
+
+1. Extraction : chaque ligne est parcourue une fois pour produire la
+   liste de ses runs (ligne, y_début, y_fin)
+2. Fusion : les runs de deux lignes consécutives qui se chevauchent
+   (selon la connectivité) sont fusionnés dans la structure Union-Find
+   partagée. Le balayage se fait avec deux index avançant en parallèle
+   sur les deux listes de runs (elles sont triées par construction)
+3. Peinture : chaque run reçoit le label compact de sa composante et
+   est écrit d'un bloc dans le tampon plat de la LabelImage
+
+Le travail devient proportionnel au nombre de runs et non au nombre de
+pixels : sur un scan de texte, cela divise typiquement le nombre
+d'opérations Union-Find par ~50.
+
+Les labels produits sont identiques à ceux d'Union-Find/Kruskal/Prim
+(numérotation compacte en ordre de parcours).
+
+COMPLEXITÉ :
+- Temps: O(N) pour l'extraction + O(R * alpha(R)) pour R runs
+- Espace: O(R) pour les runs + la structure Union-Find
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+from array import array
+from typing import List, Tuple
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from core.image import Image, BitImage, LabelImage
+from algorithms.counters import make_disjoint_set
+
+
+class RunLength:
+    """
+    Algorithme de labellisation par runs horizontaux.
+
+    Modèle : chaque run est un sommet, deux runs de lignes adjacentes
+    qui se chevauchent sont reliés ; les composantes connexes des runs
+    sont exactement celles des pixels.
+    """
+
+    @staticmethod
+    def label(input_image: Image, connectivity: int = 4) -> LabelImage:
+        """
+        Labellise les composantes connexes d'une image binaire.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Image labellisée avec les composantes connexes
+        """
+        labels, _ = RunLength._label_impl(input_image, connectivity, None)
+        return labels
+
+    @staticmethod
+    def label_with_stats(input_image: Image, connectivity: int = 4):
+        """
+        Labellise et calcule les statistiques par composante.
+
+        L'aire, la boîte englobante et le centroïde sont accumulés RUN
+        PAR RUN pendant la peinture des labels : le coût des
+        statistiques est proportionnel au nombre de runs, pas au nombre
+        de pixels.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Tuple (LabelImage, ComponentStats)
+        """
+        from algorithms.stats import ComponentStats
+        return RunLength._label_impl(input_image, connectivity, ComponentStats)
+
+    @staticmethod
+    def _label_impl(input_image: Image, connectivity: int, stats_cls):
+        """
+        Implémentation commune de label() et label_with_stats().
+
+        Args:
+            input_image: Image binaire
+            connectivity: Connectivité (4 ou 8)
+            stats_cls: Classe ComponentStats, ou None sans statistiques
+
+        Returns:
+            Tuple (LabelImage, ComponentStats ou None)
+        """
+        width = input_image.width
+        height = input_image.height
+
+        labels = LabelImage(width, height)
+
+        """
+        Étape 1 : extraction des runs de chaque ligne
+        runs[x] est la liste triée des (y_début, y_fin, id_run)
+        """
+        runs_per_row, num_runs = RunLength._extract_runs(input_image)
+
+        """
+        Étape 2 : fusion des runs qui se chevauchent entre lignes
+        consécutives (balayage à deux index sur les listes triées)
+        """
+        ds = make_disjoint_set(num_runs)
+
+        # Chevauchement élargi d'une colonne de chaque côté en 8-conn
+        reach = 1 if connectivity == 8 else 0
+
+        for x in range(1, height):
+            prev_runs = runs_per_row[x - 1]
+            cur_runs = runs_per_row[x]
+            i = 0
+            j = 0
+            while i < len(prev_runs) and j < len(cur_runs):
+                prev_start, prev_end, prev_id = prev_runs[i]
+                cur_start, cur_end, cur_id = cur_runs[j]
+
+                if prev_start < cur_end + reach and cur_start < prev_end + reach:
+                    ds.unite(prev_id, cur_id)
+
+                # Avancer sur le run qui se termine en premier
+                if prev_end < cur_end:
+                    i += 1
+                else:
+                    j += 1
+
+        """
+        Étape 3 : peinture des runs avec leurs labels compacts
+        Chaque run est écrit d'un bloc dans le tampon plat.
+        """
+        root_to_label = array('i', [0]) * num_runs
+        next_label = 1
+        out = labels.buffer
+
+        stats = stats_cls(num_runs + 1) if stats_cls is not None else None
+
+        for x in range(height):
+            base = x * width
+            for start, end, run_id in runs_per_row[x]:
+                root = ds.find(run_id)
+                if root_to_label[root] == 0:
+                    root_to_label[root] = next_label
+                    next_label += 1
+                label = root_to_label[root]
+                out[base + start:base + end] = \
+                    array('i', [label]) * (end - start)
+
+                if stats is not None:
+                    # Accumulation par run entier, pas par pixel
+                    length = end - start
+                    stats.area[label] += length
+                    if x < stats.min_x[label]:
+                        stats.min_x[label] = x
+                    if x > stats.max_x[label]:
+                        stats.max_x[label] = x
+                    if start < stats.min_y[label]:
+                        stats.min_y[label] = start
+                    if end - 1 > stats.max_y[label]:
+                        stats.max_y[label] = end - 1
+                    stats.sum_x[label] += x * length
+                    stats.sum_y[label] += (start + end - 1) * length // 2
+
+        labels.num_components = next_label - 1
+
+        return labels, stats
+
+    @staticmethod
+    def _extract_runs(input_image: Image) -> Tuple[List[List[Tuple[int, int, int]]], int]:
+        """
+        Extrait les runs horizontaux maximaux de chaque ligne.
+
+        Args:
+            input_image: Image binaire (Image 8 bits ou BitImage packée)
+
+        Returns:
+            Tuple (runs par ligne, nombre total de runs) où chaque run
+            est un triplet (y_début, y_fin, id_run) avec y_fin exclus
+        """
+        width = input_image.width
+        height = input_image.height
+
+        runs_per_row = []
+        num_runs = 0
+
+        if isinstance(input_image, BitImage):
+            # Représentation packée : extraction octet par octet via les
+            # helpers mot à mot, sans boucle par pixel
+            for x in range(height):
+                runs = []
+                for start, end in input_image.runs(x):
+                    runs.append((start, end, num_runs))
+                    num_runs += 1
+                runs_per_row.append(runs)
+            return runs_per_row, num_runs
+
+        for x in range(height):
+            row = input_image.row(x)
+            runs = []
+            y = 0
+            while y < width:
+                if row[y] == 0:
+                    y += 1
+                    continue
+                start = y
+                while y < width and row[y] != 0:
+                    y += 1
+                runs.append((start, y, num_runs))
+                num_runs += 1
+            runs_per_row.append(runs)
+
+        return runs_per_row, num_runs
@@ -0,0 +1,140 @@
+"""
+Module algorithms/scan.py - Boucles de balayage spécialisées par connectivité
+
+Les boucles par pixel des algorithmes retestaient la connectivité
+(if connectivity == 4 ... elif connectivity == 8) et les conditions de
+bord (x > 0, y > 0, y < width - 1) à CHAQUE pixel, alors que ces deux
+informations sont connues avant d'entrer dans la boucle.
+
+Ce module fournit le balayage "fusion des voisins avant" partagé par
+Union-Find et Kruskal (mode flux), spécialisé une fois à l'entrée :
+
+- le corps de boucle est choisi selon la connectivité (4 ou 8)
+- la première ligne et les colonnes extrêmes sont traitées par des
+  boucles gardées séparées
+- les pixels intérieurs — 99,9 % de l'image — exécutent un corps sans
+  aucun test de bord, avec les offsets de voisins précalculés sur le
+  tampon plat : -1 (Ouest), -width (Nord), -width-1 (Nord-Ouest),
+  -width+1 (Nord-Est)
+
+Cela retire quatre comparaisons et les appels de fonction voisinage de
+la boucle chaude de chaque algorithme.
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from core.image import Image
+from algorithms.disjoint_set import DisjointSet
+
+
+def unite_adjacent(input_image: Image, ds: DisjointSet,
+                   connectivity: int) -> None:
+    """
+    Fusionne chaque paire de pixels objet adjacents dans la structure
+    Union-Find, avec le corps de boucle spécialisé pour la connectivité.
+
+    Les voisins examinés sont les voisins "avant" (Nord/Ouest, plus les
+    diagonales Nord-Ouest/Nord-Est en 8-connectivité) : chaque paire
+    n'est traitée qu'une fois.
+
+    Args:
+        input_image: Image binaire (0 = fond, non nul = objet)
+        ds: Structure Union-Find sur les index linéaires
+        connectivity: Connectivité (4 ou 8 ; sans effet sinon)
+    """
+    width = input_image.width
+    height = input_image.height
+    if width == 0 or height == 0:
+        return
+
+    if connectivity == 4:
+        _unite_adjacent_4(input_image.buffer, width, height, ds.unite)
+    elif connectivity == 8:
+        _unite_adjacent_8(input_image.buffer, width, height, ds.unite)
+
+
+def _unite_adjacent_4(img, width: int, height: int, unite) -> None:
+    """
+    Balayage 4-connexe : voisins Ouest (-1) et Nord (-width).
+
+    Args:
+        img: Tampon plat de l'image binaire
+        width: Largeur de l'image
+        height: Hauteur de l'image
+        unite: Méthode unite de la structure Union-Find
+    """
+    # Première ligne : seul le voisin Ouest existe
+    for i in range(1, width):
+        if img[i] and img[i - 1]:
+            unite(i, i - 1)
+
+    for x in range(1, height):
+        base = x * width
+
+        # Colonne 0 : seul le voisin Nord existe
+        if img[base] and img[base - width]:
+            unite(base, base - width)
+
+        # Pixels intérieurs (et dernière colonne) : corps sans test de bord
+        for i in range(base + 1, base + width):
+            if img[i]:
+                if img[i - 1]:
+                    unite(i, i - 1)
+                if img[i - width]:
+                    unite(i, i - width)
+
+
+def _unite_adjacent_8(img, width: int, height: int, unite) -> None:
+    """
+    Balayage 8-connexe : voisins Ouest (-1), Nord-Ouest (-width-1),
+    Nord (-width) et Nord-Est (-width+1).
+
+    Args:
+        img: Tampon plat de l'image binaire
+        width: Largeur de l'image
+        height: Hauteur de l'image
+        unite: Méthode unite de la structure Union-Find
+    """
+    # Première ligne : seul le voisin Ouest existe
+    for i in range(1, width):
+        if img[i] and img[i - 1]:
+            unite(i, i - 1)
+
+    last = width - 1
+
+    for x in range(1, height):
+        base = x * width
+
+        # Colonne 0 : voisins Nord et Nord-Est
+        if img[base]:
+            if img[base - width]:
+                unite(base, base - width)
+            if width > 1 and img[base - width + 1]:
+                unite(base, base - width + 1)
+
+        # Pixels intérieurs : corps sans test de bord
+        for i in range(base + 1, base + last):
+            if img[i]:
+                if img[i - 1]:
+                    unite(i, i - 1)
+                if img[i - width - 1]:
+                    unite(i, i - width - 1)
+                if img[i - width]:
+                    unite(i, i - width)
+                if img[i - width + 1]:
+                    unite(i, i - width + 1)
+
+        # Dernière colonne : voisins Ouest, Nord-Ouest et Nord
+        if width > 1:
+            i = base + last
+            if img[i]:
+                if img[i - 1]:
+                    unite(i, i - 1)
+                if img[i - width - 1]:
+                    unite(i, i - width - 1)
+                if img[i - width]:
+                    unite(i, i - width)
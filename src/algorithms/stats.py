@@ -0,0 +1,184 @@
+"""
+Module algorithms/stats.py - Statistiques par composante connexe
+
+Structure de résultats pour les variantes label_with_stats() des
+algorithmes : aire, boîte englobante et centroïde de chaque composante,
+accumulés PENDANT la labellisation au lieu de trois passes
+supplémentaires sur l'image de labels.
+
+REPRÉSENTATION (struct-of-arrays) :
+
+Les statistiques sont des tableaux plats parallèles indexés par label
+(l'index 0, le fond, est inutilisé). Ce découpage par colonne évite un
+objet Python par composante et permet le filtrage par taille d'un
+simple parcours de tableau, sans jamais rescanner l'image.
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+from array import array
+from typing import List, Tuple
+
+_NO_MIN = 2**31 - 1
+
+
+class ComponentStats:
+    """
+    Statistiques par composante, en tableaux parallèles indexés par label.
+
+    Attributs (tableaux de taille capacity, index 0 inutilisé) :
+        area: Aire (nombre de pixels)
+        min_x, min_y, max_x, max_y: Boîte englobante (bornes incluses)
+        sum_x, sum_y: Sommes des coordonnées (pour le centroïde)
+
+    Les algorithmes accumulent directement dans ces tableaux pendant
+    leur passe de labellisation ; les accesseurs bbox()/centroid()
+    les interprètent.
+    """
+
+    def __init__(self, capacity: int):
+        """
+        Constructeur.
+
+        Args:
+            capacity: Plus grand label possible + 1
+        """
+        self.area = array('i', [0]) * capacity
+        self.min_x = array('i', [_NO_MIN]) * capacity
+        self.min_y = array('i', [_NO_MIN]) * capacity
+        self.max_x = array('i', [-1]) * capacity
+        self.max_y = array('i', [-1]) * capacity
+        self.sum_x = array('q', [0]) * capacity
+        self.sum_y = array('q', [0]) * capacity
+
+    def add_pixel(self, label: int, x: int, y: int) -> None:
+        """
+        Accumule un pixel dans la composante label.
+
+        Note: les boucles critiques des algorithmes inlinent ce code
+        directement sur les tableaux pour éviter un appel de méthode
+        par pixel ; cette méthode sert aux chemins non critiques.
+        """
+        self.area[label] += 1
+        if x < self.min_x[label]:
+            self.min_x[label] = x
+        if x > self.max_x[label]:
+            self.max_x[label] = x
+        if y < self.min_y[label]:
+            self.min_y[label] = y
+        if y > self.max_y[label]:
+            self.max_y[label] = y
+        self.sum_x[label] += x
+        self.sum_y[label] += y
+
+    def labels(self) -> List[int]:
+        """
+        Retourne les labels effectivement présents (aire > 0).
+
+        Returns:
+            Liste triée des labels
+        """
+        return [label for label in range(1, len(self.area))
+                if self.area[label] > 0]
+
+    @property
+    def num_components(self) -> int:
+        """Nombre de composantes connexes."""
+        count = 0
+        for label in range(1, len(self.area)):
+            if self.area[label] > 0:
+                count += 1
+        return count
+
+    def bbox(self, label: int) -> Tuple[int, int, int, int]:
+        """
+        Boîte englobante d'une composante.
+
+        Args:
+            label: Label de la composante
+
+        Returns:
+            Tuple (min_x, min_y, max_x, max_y), bornes incluses
+        """
+        return (self.min_x[label], self.min_y[label],
+                self.max_x[label], self.max_y[label])
+
+    def centroid(self, label: int) -> Tuple[float, float]:
+        """
+        Centroïde d'une composante.
+
+        Args:
+            label: Label de la composante
+
+        Returns:
+            Tuple (x, y) en coordonnées flottantes
+        """
+        area = self.area[label]
+        return (self.sum_x[label] / area, self.sum_y[label] / area)
+
+    def filter_labels(self, min_area: int = 1, max_area: int = 0) -> List[int]:
+        """
+        Filtre les composantes par aire, sans rescanner l'image.
+
+        Args:
+            min_area: Aire minimale (incluse)
+            max_area: Aire maximale (incluse), 0 = pas de limite
+
+        Returns:
+            Liste des labels retenus
+        """
+        result = []
+        for label in range(1, len(self.area)):
+            area = self.area[label]
+            if area >= min_area and (max_area == 0 or area <= max_area):
+                result.append(label)
+        return result
+
+    @classmethod
+    def from_label_image(cls, label_image) -> 'ComponentStats':
+        """
+        Accumule les statistiques depuis une image de labels existante.
+
+        Chemin générique en une seule passe, utilisé par les algorithmes
+        dont la structure ne permet pas d'accumuler pendant la
+        labellisation elle-même.
+
+        Args:
+            label_image: LabelImage
+
+        Returns:
+            ComponentStats rempli
+        """
+        buf = label_image.buffer
+        max_label = max(buf, default=0)
+        stats = cls(max_label + 1)
+
+        width = label_image.width
+        area = stats.area
+        min_x = stats.min_x
+        min_y = stats.min_y
+        max_x = stats.max_x
+        max_y = stats.max_y
+        sum_x = stats.sum_x
+        sum_y = stats.sum_y
+
+        i = 0
+        for x in range(label_image.height):
+            for y in range(width):
+                label = buf[i]
+                i += 1
+                if label == 0:
+                    continue
+                area[label] += 1
+                if x < min_x[label]:
+                    min_x[label] = x
+                if x > max_x[label]:
+                    max_x[label] = x
+                if y < min_y[label]:
+                    min_y[label] = y
+                if y > max_y[label]:
+                    max_y[label] = y
+                sum_x[label] += x
+                sum_y[label] += y
+
+        return stats
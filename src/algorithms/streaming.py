@@ -0,0 +1,169 @@
+"""
+Module algorithms/streaming.py - Labellisation en flux (deux lignes)
+
+Mode streaming de l'algorithme Two-Pass pour les images plus grandes
+que la RAM.
+
+PRINCIPE :
+
+La première passe du Two-Pass (two_pass.py) ne regarde jamais que la
+ligne courante et la ligne précédente. On peut donc labelliser un PGM
+binaire (P5) lu ligne par ligne depuis le disque (ImageIO.read_pgm_rows)
+en ne gardant que O(width) pixels en mémoire :
+
+1. Passe 1 (flux) : parcours du fichier ligne par ligne, étiquetage
+   provisoire avec la fenêtre de deux lignes, équivalences enregistrées
+   dans la table partagée. Seules la table (O(nb_labels)) et deux lignes
+   survivent à cette passe
+2. Résolution : les équivalences sont résolues et les labels racine sont
+   compactés (1, 2, 3...) dans une table de correspondance
+3. Passe 2 (flux) : relecture du fichier, ré-étiquetage provisoire
+   déterministe (mêmes règles, mêmes labels), remappage via la table et
+   émission immédiate de chaque ligne finale vers le flux de sortie
+
+La mémoire de pointe passe de O(N) à O(width + nb_labels), ce qui permet
+de labelliser des scans arbitrairement hauts sur de petits conteneurs,
+au prix d'une seconde lecture du fichier.
+
+La sortie est un PGM (P5) normalisé sur [0, 255], identique à
+LabelImage.to_visualization().
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+from array import array
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from algorithms.two_pass import EquivalenceTable
+
+
+class StreamingTwoPass:
+    """
+    Labellisation Two-Pass en flux, à état O(width).
+
+    Lit un PGM binaire (P5) ligne par ligne et écrit la visualisation
+    des labels ligne par ligne, sans jamais matérialiser l'image
+    complète ni l'image de labels.
+    """
+
+    @staticmethod
+    def label_file(input_path: str, output_path: str,
+                   connectivity: int = 4, threshold: int = 128) -> int:
+        """
+        Labellise un fichier PGM (P5) en flux.
+
+        Args:
+            input_path: Chemin du PGM binaire d'entrée
+            output_path: Chemin du PGM de sortie (labels normalisés)
+            connectivity: Type de connectivité (4 ou 8)
+            threshold: Seuil de binarisation appliqué à chaque ligne
+
+        Returns:
+            Nombre de composantes connexes trouvées
+        """
+        from readers.image_io import ImageIO
+
+        # Passe 1 : étiquetage provisoire en flux + équivalences
+        equiv = EquivalenceTable()
+        width, height, _, rows = ImageIO.read_pgm_rows(input_path)
+        for _ in StreamingTwoPass._provisional_rows(
+                rows, width, connectivity, threshold, equiv):
+            pass
+
+        # Résolution : labels racine -> labels compacts
+        num_labels = equiv.size() - 1
+        compact = array('i', [0]) * (num_labels + 1)
+        num_components = 0
+        for label in range(1, num_labels + 1):
+            root = equiv.find(label)
+            if compact[root] == 0:
+                num_components += 1
+                compact[root] = num_components
+            compact[label] = compact[root]
+
+        # Table label provisoire -> octet de visualisation [0, 255]
+        vis = bytearray(num_labels + 1)
+        if num_components > 0:
+            for label in range(1, num_labels + 1):
+                vis[label] = ((compact[label] * 254) // num_components) + 1
+
+        # Passe 2 : ré-étiquetage déterministe + émission des lignes
+        width, height, _, rows = ImageIO.read_pgm_rows(input_path)
+        with open(output_path, 'wb') as out:
+            ImageIO.write_pgm_header(out, width, height, 255)
+            out_row = bytearray(width)
+            for labels_row in StreamingTwoPass._provisional_rows(
+                    rows, width, connectivity, threshold, None):
+                for y in range(width):
+                    out_row[y] = vis[labels_row[y]]
+                out.write(out_row)
+
+        return num_components
+
+    @staticmethod
+    def _provisional_rows(rows, width: int, connectivity: int,
+                          threshold: int, equiv):
+        """
+        Étiquetage provisoire en flux avec fenêtre de deux lignes.
+
+        Applique exactement les règles de TwoPass._first_pass (plus
+        petit label voisin, nouveau label sinon) sur les lignes
+        binarisées. L'attribution des labels provisoires est
+        déterministe : rejouer le même flux redonne les mêmes labels.
+
+        Args:
+            rows: Itérable des lignes de pixels (bytes)
+            width: Largeur de l'image
+            connectivity: Connectivité (4 ou 8)
+            threshold: Seuil de binarisation
+            equiv: Table d'équivalence à alimenter, ou None pour la
+                   passe de relecture (les unions sont alors ignorées)
+
+        Yields:
+            array('i') des labels provisoires de chaque ligne
+        """
+        prev_labels = array('i', [0]) * width
+        next_label = 0
+
+        for raw_row in rows:
+            pixels = bytes(
+                255 if raw_row[y] >= threshold else 0 for y in range(width))
+            labels = array('i', [0]) * width
+
+            for y in range(width):
+                if pixels[y] == 0:
+                    continue
+
+                # Voisins déjà traités : NW, N, NE (ligne précédente), W
+                min_label = 0
+                n1 = n2 = n3 = n4 = 0
+                if connectivity == 8 and y > 0:
+                    n1 = prev_labels[y - 1]
+                n2 = prev_labels[y]
+                if connectivity == 8 and y < width - 1:
+                    n3 = prev_labels[y + 1]
+                if y > 0:
+                    n4 = labels[y - 1]
+
+                for neighbor in (n1, n2, n3, n4):
+                    if neighbor > 0 and (min_label == 0 or neighbor < min_label):
+                        min_label = neighbor
+
+                if min_label == 0:
+                    next_label += 1
+                    if equiv is not None:
+                        equiv.make_set()
+                    labels[y] = next_label
+                    continue
+
+                labels[y] = min_label
+                if equiv is not None:
+                    for neighbor in (n1, n2, n3, n4):
+                        if neighbor > 0 and neighbor != min_label:
+                            equiv.unite(min_label, neighbor)
+
+            yield labels
+
+            prev_labels = labels
@@ -16,12 +16,16 @@ PRINCIPE (décrit dans la source ESIEE) :
           - Noter l'équivalence dans la table
 
 Passe intermédiaire - Résolution des équivalences :
-   - Calculer les "labels racine" pour chaque classe d'équivalence
-   - Utilise une structure Union-Find simplifiée
+   - Construire UNE FOIS la table label provisoire -> label final
+     (compact_lut), en résolvant chaque classe dans l'Union-Find partagé
 
 2ème Passe - Relabellisation finale :
-   - Parcours de l'image
-   - Remplacer chaque label provisoire par son label racine
+   - Parcours du tampon plat
+   - Remplacer chaque label provisoire par la table (aucun find par pixel)
+
+Les labels finaux sont compacts (1, 2, 3, ...) dans l'ordre du premier
+pixel de chaque composante : la numérotation est identique à celle de
+UnionFind, Kruskal, Prim et RunLength.
 
 COMPLEXITÉ :
 - Temps: O(N) où N est le nombre de pixels (2 passes linéaires)
@@ -33,25 +37,30 @@ Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 
 import sys
 import os
+from array import array
 from typing import List, Tuple
 
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from core.image import Image, LabelImage
+from algorithms.counters import make_disjoint_set
 
 
 class EquivalenceTable:
     """
     Structure pour gérer les équivalences entre labels.
 
-    Implémente une version simplifiée d'Union-Find :
-    - Chaque label pointe vers son "parent"
-    - La racine d'un label est trouvée par remontée
-    - Path compression pour optimiser les recherches
+    S'appuie sur la structure Union-Find partagée (disjoint_set.py,
+    find itératif + union par taille). La racine d'une classe est un
+    représentant arbitraire ; la numérotation finale est fixée en une
+    fois par compact_lut(), jamais par la racine elle-même.
     """
 
     def __init__(self):
         """Initialise la table d'équivalence. Label 0 réservé pour le fond."""
-        self._parent = [0]
+        # La fabrique fournit la variante comptante quand les compteurs
+        # d'opérations sont actifs (voir algorithms/counters.py)
+        self._ds = make_disjoint_set(1)
+        self._num_classes = 0
 
     def make_set(self) -> int:
         """
@@ -60,53 +69,78 @@ class EquivalenceTable:
         Returns:
             Nouveau label
         """
-        label = len(self._parent)
-        self._parent.append(label)
-        return label
+        self._num_classes += 1
+        return self._ds.make_set()
 
     def find(self, x: int) -> int:
         """
-        Trouve la racine d'un label (avec path compression).
+        Trouve le représentant de la classe d'équivalence de x.
 
         Args:
             x: Label
 
         Returns:
-            Label racine
+            Label racine (représentant canonique de la classe)
         """
-        if x <= 0 or x >= len(self._parent):
+        if x <= 0 or x >= len(self._ds):
             return 0
 
-        if self._parent[x] != x:
-            self._parent[x] = self.find(self._parent[x])
-
-        return self._parent[x]
+        return self._ds.find(x)
 
     def unite(self, x: int, y: int) -> None:
         """
-        Fusionne deux labels (union).
-
-        Fait pointer le plus grand label vers le plus petit
-        pour minimiser les labels finaux.
+        Fusionne deux labels (union équilibrée par taille).
 
         Args:
             x: Premier label
             y: Deuxième label
         """
-        root_x = self.find(x)
-        root_y = self.find(y)
+        if self._ds.unite(x, y):
+            self._num_classes -= 1
 
-        if root_x == root_y:
-            return
+    def compact_lut(self) -> array:
+        """
+        Construit la table label provisoire -> label final compact.
+
+        Les labels finaux sont attribués en parcourant les labels
+        provisoires en ordre croissant : chaque classe reçoit son
+        numéro à la rencontre de son plus petit label provisoire,
+        c'est-à-dire dans l'ordre du premier pixel de chaque composante.
+        C'est exactement la numérotation de UnionFind/Kruskal/Prim.
+
+        Coût : O(L) appels find, L = nombre de labels provisoires —
+        à comparer à un find par pixel dans l'ancienne deuxième passe.
+
+        Returns:
+            array('i') indexé par label provisoire (lut[0] = 0)
+        """
+        size = len(self._ds)
+        lut = array('i', [0]) * size
+        find = self._ds.find
+        next_label = 0
 
-        if root_x < root_y:
-            self._parent[root_y] = root_x
-        else:
-            self._parent[root_x] = root_y
+        for label in range(1, size):
+            root = find(label)
+            if lut[root] == 0:
+                next_label += 1
+                lut[root] = next_label
+            lut[label] = lut[root]
+
+        return lut
 
     def size(self) -> int:
         """Retourne le nombre de labels."""
-        return len(self._parent)
+        return len(self._ds)
+
+    def num_classes(self) -> int:
+        """
+        Retourne le nombre de classes d'équivalence.
+
+        Chaque classe correspond à exactement une composante connexe :
+        le compteur est incrémenté par make_set et décrémenté par
+        chaque fusion effective.
+        """
+        return self._num_classes
 
 
 class TwoPass:
@@ -140,8 +174,46 @@ class TwoPass:
         TwoPass._first_pass(input_image, labels, equiv, connectivity)
         TwoPass._second_pass(labels, equiv)
 
+        labels.num_components = equiv.num_classes()
+
         return labels
 
+    @staticmethod
+    def label_with_stats(input_image: Image, connectivity: int = 4):
+        """
+        Labellise et calcule les statistiques par composante en une
+        seule passe supplémentaire.
+
+        L'aire, la boîte englobante et le centroïde de chaque composante
+        sont accumulés PENDANT la deuxième passe, au lieu de trois
+        parcours séparés de l'image de labels.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Tuple (LabelImage, ComponentStats)
+        """
+        from algorithms.stats import ComponentStats
+
+        width = input_image.width
+        height = input_image.height
+
+        labels = LabelImage(width, height)
+        labels.fill(0)
+
+        equiv = EquivalenceTable()
+
+        TwoPass._first_pass(input_image, labels, equiv, connectivity)
+
+        stats = ComponentStats(equiv.size())
+        TwoPass._second_pass_with_stats(labels, equiv, stats)
+
+        labels.num_components = equiv.num_classes()
+
+        return labels, stats
+
     @staticmethod
     def _first_pass(input_image: Image, labels: LabelImage,
                     equiv: EquivalenceTable, connectivity: int) -> None:
@@ -155,9 +227,14 @@ class TwoPass:
            a) Aucun voisin objet -> créer un nouveau label
            b) Un seul label parmi les voisins -> utiliser ce label
            c) Plusieurs labels différents -> collision d'équivalence
-              - Utiliser le plus petit label
               - Enregistrer l'équivalence dans la table
 
+        Le corps de boucle est spécialisé une fois à l'entrée selon la
+        connectivité : les pixels intérieurs exécutent un arbre de
+        décision sans test de bord sur le tampon plat (offsets -1,
+        -width, -width-1, -width+1), seules la première ligne et les
+        colonnes extrêmes passent par des boucles gardées.
+
         Args:
             input_image: Image binaire
             labels: Image de labels (sortie)
@@ -166,7 +243,19 @@ class TwoPass:
         """
         width = input_image.width
         height = input_image.height
+        if width == 0 or height == 0:
+            return
+
+        if connectivity == 4:
+            TwoPass._first_pass_4(input_image.buffer, labels.buffer,
+                                  width, height, equiv)
+            return
+        if connectivity == 8:
+            TwoPass._first_pass_8(input_image.buffer, labels.buffer,
+                                  width, height, equiv)
+            return
 
+        # Connectivité non standard : version générique gardée
         for x in range(height):
             for y in range(width):
                 if input_image.at(x, y) == 0:
@@ -197,13 +286,171 @@ class TwoPass:
                         if neighbor_labels[i] != min_label:
                             equiv.unite(min_label, neighbor_labels[i])
 
+    @staticmethod
+    def _first_pass_4(img, lab, width: int, height: int,
+                      equiv: EquivalenceTable) -> None:
+        """
+        Première passe spécialisée 4-connexité (voisins Ouest et Nord).
+
+        Opère directement sur les tampons plats ; le label provisoire
+        écrit peut différer de la règle "plus petit voisin" de la
+        version générique, mais comme la deuxième passe renumérote
+        chaque classe d'équivalence d'un bloc, les labels finaux sont
+        identiques.
+
+        Args:
+            img: Tampon plat de l'image binaire
+            lab: Tampon plat des labels (sortie)
+            width: Largeur de l'image
+            height: Hauteur de l'image
+            equiv: Table d'équivalence (sortie)
+        """
+        make_set = equiv.make_set
+        unite = equiv.unite
+
+        # Première ligne : seul le voisin Ouest existe
+        if img[0]:
+            lab[0] = make_set()
+        for i in range(1, width):
+            if img[i]:
+                lab[i] = lab[i - 1] if img[i - 1] else make_set()
+
+        for x in range(1, height):
+            base = x * width
+
+            # Colonne 0 : seul le voisin Nord existe
+            if img[base]:
+                lab[base] = lab[base - width] if img[base - width] \
+                    else make_set()
+
+            # Pixels intérieurs (et dernière colonne) : sans test de bord
+            for i in range(base + 1, base + width):
+                if img[i]:
+                    if img[i - 1]:
+                        west = lab[i - 1]
+                        if img[i - width]:
+                            north = lab[i - width]
+                            if north < west:
+                                lab[i] = north
+                                unite(north, west)
+                            elif west < north:
+                                lab[i] = west
+                                unite(west, north)
+                            else:
+                                lab[i] = west
+                        else:
+                            lab[i] = west
+                    elif img[i - width]:
+                        lab[i] = lab[i - width]
+                    else:
+                        lab[i] = make_set()
+
+    @staticmethod
+    def _first_pass_8(img, lab, width: int, height: int,
+                      equiv: EquivalenceTable) -> None:
+        """
+        Première passe spécialisée 8-connexité (Ouest, Nord-Ouest,
+        Nord, Nord-Est).
+
+        L'arbre de décision exploite les équivalences déjà établies
+        lors du balayage de la ligne précédente : si Nord est objet,
+        Nord-Ouest et Nord-Est lui sont déjà équivalents (chacun a vu
+        l'autre comme voisin Ouest/Nord), seul Ouest peut apporter une
+        classe nouvelle. De même, Ouest est déjà équivalent à
+        Nord-Ouest quand les deux sont objet. Chaque pixel intérieur
+        fait donc au plus deux unions au lieu de quatre, sans aucun
+        test de bord.
+
+        Comme pour la version 4-connexité, le label provisoire écrit
+        peut différer de la règle "plus petit voisin", mais la
+        renumérotation par classe de la deuxième passe produit des
+        labels finaux identiques.
+
+        Args:
+            img: Tampon plat de l'image binaire
+            lab: Tampon plat des labels (sortie)
+            width: Largeur de l'image
+            height: Hauteur de l'image
+            equiv: Table d'équivalence (sortie)
+        """
+        make_set = equiv.make_set
+        unite = equiv.unite
+
+        # Première ligne : seul le voisin Ouest existe
+        if img[0]:
+            lab[0] = make_set()
+        for i in range(1, width):
+            if img[i]:
+                lab[i] = lab[i - 1] if img[i - 1] else make_set()
+
+        last = width - 1
+
+        for x in range(1, height):
+            base = x * width
+
+            # Colonne 0 : voisins Nord et Nord-Est
+            if img[base]:
+                if img[base - width]:
+                    lab[base] = lab[base - width]
+                elif width > 1 and img[base - width + 1]:
+                    lab[base] = lab[base - width + 1]
+                else:
+                    lab[base] = make_set()
+
+            # Pixels intérieurs : sans test de bord
+            for i in range(base + 1, base + last):
+                if not img[i]:
+                    continue
+                if img[i - width]:
+                    north = lab[i - width]
+                    lab[i] = north
+                    if img[i - 1]:
+                        west = lab[i - 1]
+                        if west != north:
+                            unite(west, north)
+                elif img[i - width - 1]:
+                    nw = lab[i - width - 1]
+                    lab[i] = nw
+                    if img[i - width + 1]:
+                        ne = lab[i - width + 1]
+                        if ne != nw:
+                            unite(nw, ne)
+                elif img[i - 1]:
+                    west = lab[i - 1]
+                    lab[i] = west
+                    if img[i - width + 1]:
+                        ne = lab[i - width + 1]
+                        if ne != west:
+                            unite(west, ne)
+                elif img[i - width + 1]:
+                    lab[i] = lab[i - width + 1]
+                else:
+                    lab[i] = make_set()
+
+            # Dernière colonne : voisins Ouest, Nord-Ouest et Nord
+            if width > 1:
+                i = base + last
+                if img[i]:
+                    if img[i - width]:
+                        north = lab[i - width]
+                        lab[i] = north
+                        if img[i - 1] and lab[i - 1] != north:
+                            unite(lab[i - 1], north)
+                    elif img[i - width - 1]:
+                        lab[i] = lab[i - width - 1]
+                    elif img[i - 1]:
+                        lab[i] = lab[i - 1]
+                    else:
+                        lab[i] = make_set()
+
     @staticmethod
     def _second_pass(labels: LabelImage, equiv: EquivalenceTable) -> None:
         """
-        Deuxième passe : relabellisation avec les labels racine.
+        Deuxième passe : relabellisation par table de remappage.
 
-        Remplace chaque label provisoire par son label racine
-        (résolution des équivalences).
+        Les équivalences sont résolues UNE FOIS dans la table compacte
+        (compact_lut), puis appliquées au tampon plat en un parcours
+        linéaire : une indexation par pixel objet, aucun appel find.
 
         Cette passe garantit que tous les pixels d'une même composante
         connexe auront exactement le même label final.
@@ -212,14 +459,62 @@ class TwoPass:
             labels: Image de labels (entrée/sortie)
             equiv: Table d'équivalence
         """
+        lut = equiv.compact_lut()
+        buf = labels.buffer
+
+        for i in range(len(buf)):
+            label = buf[i]
+            if label > 0:
+                buf[i] = lut[label]
+
+    @staticmethod
+    def _second_pass_with_stats(labels: LabelImage, equiv: EquivalenceTable,
+                                stats) -> None:
+        """
+        Deuxième passe fusionnée : relabellisation + statistiques.
+
+        Identique à _second_pass, mais accumule au passage l'aire, la
+        boîte englobante et les sommes de coordonnées de chaque
+        composante dans les tableaux parallèles de ComponentStats
+        (accès directs, pas d'appel de méthode par pixel).
+
+        Args:
+            labels: Image de labels (entrée/sortie)
+            equiv: Table d'équivalence
+            stats: ComponentStats à remplir
+        """
         width = labels.width
         height = labels.height
-
+        buf = labels.buffer
+        lut = equiv.compact_lut()
+
+        area = stats.area
+        min_x = stats.min_x
+        min_y = stats.min_y
+        max_x = stats.max_x
+        max_y = stats.max_y
+        sum_x = stats.sum_x
+        sum_y = stats.sum_y
+
+        i = 0
         for x in range(height):
             for y in range(width):
-                label = labels.at(x, y)
+                label = buf[i]
                 if label > 0:
-                    labels.set_at(x, y, equiv.find(label))
+                    label = lut[label]
+                    buf[i] = label
+                    area[label] += 1
+                    if x < min_x[label]:
+                        min_x[label] = x
+                    if x > max_x[label]:
+                        max_x[label] = x
+                    if y < min_y[label]:
+                        min_y[label] = y
+                    if y > max_y[label]:
+                        max_y[label] = y
+                    sum_x[label] += x
+                    sum_y[label] += y
+                i += 1
 
     @staticmethod
     def _get_previous_neighbors(x: int, y: int, width: int, height: int,
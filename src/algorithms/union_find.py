@@ -24,11 +24,11 @@ STRUCTURE UNION-FIND (CM05: modèle de partition) :
 Cette structure maintient une partition de l'ensemble des pixels.
 Chaque partition représente une composante connexe.
 
-OPTIMISATIONS :
-- Path compression : lors de Find, faire pointer tous les noeuds
-  parcourus directement vers la racine
-- Union by rank : lors de Union, attacher l'arbre de rang inférieur
-  sous l'arbre de rang supérieur
+OPTIMISATIONS (voir algorithms/disjoint_set.py) :
+- Path halving : lors de Find (itératif), chaque noeud parcouru est
+  raccroché à son grand-parent
+- Union by size : lors de Union, l'arbre le plus petit est attaché
+  sous le plus grand
 
 COMPLEXITÉ :
 - Temps: O(N * alpha(N)) = O(N) où N est le nombre de pixels
@@ -43,74 +43,8 @@ from typing import List
 
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from core.image import Image, LabelImage
-
-
-class DisjointSet:
-    """
-    Structure Union-Find optimisée.
-
-    Implémente la structure de données Disjoint-Set avec :
-    - Path compression dans Find
-    - Union by rank
-    """
-
-    def __init__(self, size: int):
-        """
-        Constructeur.
-
-        Args:
-            size: Nombre d'éléments
-        """
-        self._parent = list(range(size))
-        self._rank = [0] * size
-
-    def find(self, x: int) -> int:
-        """
-        Trouve le représentant de l'ensemble contenant x.
-
-        Utilise la path compression : tous les noeuds parcourus
-        sont directement reliés à la racine pour accélérer les
-        futurs Find.
-
-        Args:
-            x: Élément
-
-        Returns:
-            Représentant (racine) de l'ensemble
-        """
-        if self._parent[x] != x:
-            self._parent[x] = self.find(self._parent[x])
-        return self._parent[x]
-
-    def unite(self, x: int, y: int) -> bool:
-        """
-        Fusionne les ensembles contenant x et y.
-
-        Utilise union by rank : l'arbre de rang inférieur est attaché
-        sous l'arbre de rang supérieur pour maintenir l'arbre plat.
-
-        Args:
-            x: Premier élément
-            y: Deuxième élément
-
-        Returns:
-            True si fusion effectuée, False si déjà dans le même ensemble
-        """
-        root_x = self.find(x)
-        root_y = self.find(y)
-
-        if root_x == root_y:
-            return False
-
-        if self._rank[root_x] < self._rank[root_y]:
-            self._parent[root_x] = root_y
-        elif self._rank[root_x] > self._rank[root_y]:
-            self._parent[root_y] = root_x
-        else:
-            self._parent[root_y] = root_x
-            self._rank[root_x] += 1
-
-        return True
+from algorithms.counters import make_disjoint_set
+from algorithms.scan import unite_adjacent
 
 
 class UnionFind:
@@ -139,7 +73,7 @@ class UnionFind:
         height = input_image.height
         size = width * height
 
-        ds = DisjointSet(size)
+        ds = make_disjoint_set(size)
         labels = LabelImage(width, height)
         labels.fill(0)
 
@@ -147,30 +81,11 @@ class UnionFind:
         Phase 1 : Union des pixels adjacents
         On parcourt les voisins "avant" (Nord/Ouest pour 4-conn,
         + diagonales Nord-Ouest/Nord-Est pour 8-conn) pour éviter
-        de traiter deux fois la même paire.
+        de traiter deux fois la même paire. Le corps de boucle est
+        spécialisé par connectivité et par zone intérieur/bord
+        (voir algorithms/scan.py).
         """
-        for x in range(height):
-            for y in range(width):
-                if input_image.at(x, y) == 0:
-                    continue
-
-                current_idx = UnionFind._get_index(x, y, width)
-
-                if connectivity == 4:
-                    if x > 0 and input_image.at(x - 1, y) != 0:
-                        ds.unite(current_idx, UnionFind._get_index(x - 1, y, width))
-                    if y > 0 and input_image.at(x, y - 1) != 0:
-                        ds.unite(current_idx, UnionFind._get_index(x, y - 1, width))
-
-                elif connectivity == 8:
-                    if x > 0 and y > 0 and input_image.at(x - 1, y - 1) != 0:
-                        ds.unite(current_idx, UnionFind._get_index(x - 1, y - 1, width))
-                    if x > 0 and input_image.at(x - 1, y) != 0:
-                        ds.unite(current_idx, UnionFind._get_index(x - 1, y, width))
-                    if x > 0 and y < width - 1 and input_image.at(x - 1, y + 1) != 0:
-                        ds.unite(current_idx, UnionFind._get_index(x - 1, y + 1, width))
-                    if y > 0 and input_image.at(x, y - 1) != 0:
-                        ds.unite(current_idx, UnionFind._get_index(x, y - 1, width))
+        unite_adjacent(input_image, ds, connectivity)
 
         """
         Phase 2 : Labellisation finale
@@ -195,8 +110,31 @@ class UnionFind:
 
                 labels.set_at(x, y, root_to_label[root])
 
+        # Le compteur de labels compacts donne directement le nombre de
+        # composantes : count_labels() n'aura pas à rebalayer l'image
+        labels.num_components = next_label - 1
+
         return labels
 
+    @staticmethod
+    def label_with_stats(input_image: Image, connectivity: int = 4):
+        """
+        Labellise et calcule les statistiques par composante (aire,
+        boîte englobante, centroïde) en une seule passe supplémentaire
+        sur l'image de labels.
+
+        Args:
+            input_image: Image binaire (0 = fond, 255 = objet)
+            connectivity: Type de connectivité (4 ou 8)
+
+        Returns:
+            Tuple (LabelImage, ComponentStats)
+        """
+        from algorithms.stats import ComponentStats
+
+        labels = UnionFind.label(input_image, connectivity)
+        return labels, ComponentStats.from_label_image(labels)
+
     @staticmethod
     def _get_index(x: int, y: int, width: int) -> int:
         """
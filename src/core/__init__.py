@@ -1,4 +1,4 @@
-# Core module - Image, LabelImage et ColorImage
-from .image import Image, LabelImage, Pixel, ColorImage
+# Core module - Image, BitImage, LabelImage, ColorImage et ImageVolume
+from .image import Image, BitImage, LabelImage, Pixel, ColorImage, ImageVolume
 
-__all__ = ["Image", "LabelImage", "Pixel", "ColorImage"]
+__all__ = ["Image", "BitImage", "LabelImage", "Pixel", "ColorImage", "ImageVolume"]
@@ -5,13 +5,28 @@ Ce module implémente les structures de données de base pour le traitement d'im
 Toutes les opérations sont implémentées manuellement sans bibliothèque externe.
 
 Note: numpy est utilisé UNIQUEMENT dans io/image_io.py pour charger l'image
-depuis un fichier. Ici, tout est fait avec des listes Python pures.
+depuis un fichier. Ici, tout est fait avec les types natifs de Python.
+
+STOCKAGE :
+
+Les pixels sont stockés dans un tampon plat contigu (row-major) :
+- Image      : bytearray (1 octet par pixel)
+- LabelImage : array('i') (entier 32 bits par pixel)
+
+Le pixel (x, y) est à l'index x * width + y. Par rapport à une liste de
+listes, ce stockage supprime une indirection par accès, divise la mémoire
+par ~30 (pas d'entiers boxés) et améliore fortement la localité cache des
+parcours ligne par ligne des algorithmes.
+
+La propriété `data` reste exposée sous forme de liste 2D pour la
+compatibilité avec le code existant (conversion à la volée).
 
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
 
+from array import array
 from dataclasses import dataclass
-from typing import List, Optional
+from typing import List, Optional, Tuple
 
 
 @dataclass
@@ -42,7 +57,8 @@ class Image:
     Cette classe implémente toutes les opérations de base sur les images
     sans utiliser de bibliothèque externe.
 
-    L'image est stockée en mémoire comme une liste 2D Python.
+    L'image est stockée en mémoire dans un bytearray plat row-major
+    (1 octet par pixel, index = x * width + y).
     """
 
     def __init__(self, width: int = 0, height: int = 0, max_value: int = 255):
@@ -59,9 +75,9 @@ class Image:
         self._max_value = max_value
 
         if width > 0 and height > 0:
-            self._data = [[0 for _ in range(width)] for _ in range(height)]
+            self._buffer = bytearray(width * height)
         else:
-            self._data = []
+            self._buffer = bytearray()
 
     @property
     def width(self) -> int:
@@ -83,21 +99,77 @@ class Image:
         """Nombre total de pixels."""
         return self._width * self._height
 
+    @property
+    def buffer(self) -> bytearray:
+        """
+        Accès direct au tampon plat row-major (1 octet par pixel).
+
+        C'est le stockage réel de l'image : les boucles critiques peuvent
+        l'indexer directement (index = x * width + y) sans passer par
+        at()/set_at().
+        """
+        return self._buffer
+
     @property
     def data(self) -> List[List[int]]:
-        """Accès direct aux données."""
-        return self._data
+        """
+        Vue liste 2D des données (compatibilité).
+
+        Construit une copie liste-de-listes du tampon plat. À réserver
+        au code non critique : les boucles chaudes doivent utiliser
+        `buffer` ou `row()`.
+        """
+        width = self._width
+        return [list(self._buffer[x * width:(x + 1) * width])
+                for x in range(self._height)]
 
     @data.setter
     def data(self, value: List[List[int]]):
-        """Définit les données de l'image."""
-        self._data = value
+        """Définit les données de l'image depuis une liste 2D."""
         if value and len(value) > 0:
             self._height = len(value)
             self._width = len(value[0]) if value[0] else 0
+            self._buffer = bytearray(self._width * self._height)
+            width = self._width
+            for x in range(self._height):
+                self._buffer[x * width:(x + 1) * width] = bytes(value[x])
         else:
             self._height = 0
             self._width = 0
+            self._buffer = bytearray()
+
+    def adopt_buffer(self, buffer, width: int, height: int):
+        """
+        Adopte un tampon plat existant sans copie.
+
+        Args:
+            buffer: Objet bytes-like de taille width * height
+            width: Largeur de l'image
+            height: Hauteur de l'image
+        """
+        if len(buffer) != width * height:
+            raise ValueError("Taille du tampon incompatible avec les dimensions")
+        self._buffer = buffer
+        self._width = width
+        self._height = height
+
+    def row(self, x: int) -> memoryview:
+        """
+        Retourne une memoryview sur la ligne x (sans copie).
+
+        Permet aux boucles internes d'itérer une ligne entière sans
+        appel de méthode par pixel.
+
+        Args:
+            x: Coordonnée ligne
+
+        Returns:
+            memoryview sur les pixels de la ligne
+        """
+        if x < 0 or x >= self._height:
+            raise IndexError("Ligne hors limites")
+        start = x * self._width
+        return memoryview(self._buffer)[start:start + self._width]
 
     def at(self, x: int, y: int) -> int:
         """
@@ -112,7 +184,7 @@ class Image:
         """
         if not self.is_valid(x, y):
             raise IndexError("Coordonnées hors limites")
-        return self._data[x][y]
+        return self._buffer[x * self._width + y]
 
     def set_at(self, x: int, y: int, value: int):
         """
@@ -129,7 +201,7 @@ class Image:
             value = 0
         elif value > 255:
             value = 255
-        self._data[x][y] = value
+        self._buffer[x * self._width + y] = value
 
     def is_valid(self, x: int, y: int) -> bool:
         """
@@ -151,9 +223,7 @@ class Image:
         Args:
             value: Valeur à affecter à tous les pixels
         """
-        for x in range(self._height):
-            for y in range(self._width):
-                self._data[x][y] = value
+        self._buffer[:] = bytes([value]) * (self._width * self._height)
 
     def copy_from(self, other: 'Image'):
         """
@@ -165,23 +235,38 @@ class Image:
         self._width = other._width
         self._height = other._height
         self._max_value = other._max_value
-        self._data = [[other._data[x][y] for y in range(other._width)]
-                      for x in range(other._height)]
+        self._buffer = bytearray(other._buffer)
 
-    def binarize(self, threshold: int):
+    def binarize(self, threshold: int) -> None:
         """
-        Binarise l'image avec un seuil.
+        Binarise l'image en place avec un seuil.
         Les pixels >= threshold deviennent 255, les autres 0.
 
+        La représentation packée 1 bit/pixel s'obtient séparément via
+        to_bit_image() : le package n'est payé que par les appelants
+        qui en ont l'usage.
+
         Args:
             threshold: Seuil de binarisation
         """
-        for x in range(self._height):
-            for y in range(self._width):
-                if self._data[x][y] >= threshold:
-                    self._data[x][y] = 255
-                else:
-                    self._data[x][y] = 0
+        # Table octet -> 0/255 appliquée en un passage C ; translate
+        # n'existe pas sur memoryview (tampon adopté par mmap), on
+        # passe alors par une copie bytes
+        lut = bytes(255 if value >= threshold else 0 for value in range(256))
+        buffer = self._buffer
+        if isinstance(buffer, bytearray):
+            buffer[:] = buffer.translate(lut)
+        else:
+            buffer[:] = bytes(buffer).translate(lut)
+
+    def to_bit_image(self) -> 'BitImage':
+        """
+        Packe l'image (déjà binarisée) à 1 bit par pixel.
+
+        Returns:
+            BitImage dont les bits à 1 sont les pixels non nuls
+        """
+        return BitImage.from_image(self)
 
     def copy(self) -> 'Image':
         """
@@ -191,18 +276,302 @@ class Image:
             Nouvelle instance Image avec les mêmes données
         """
         new_image = Image(self._width, self._height, self._max_value)
-        for x in range(self._height):
-            for y in range(self._width):
-                new_image._data[x][y] = self._data[x][y]
+        new_image._buffer = bytearray(self._buffer)
         return new_image
 
 
+class BitImage:
+    """
+    Image binaire packée à 1 bit par pixel.
+
+    Après binarisation, chaque pixel ne porte qu'un bit d'information :
+    le stockage packé divise le working set d'entrée par 8 par rapport au
+    bytearray d'Image (et bien plus par rapport à des entiers boxés).
+
+    STOCKAGE :
+
+    Chaque ligne occupe row_stride = ceil(width / 8) octets consécutifs ;
+    le bit du pixel (x, y) est le bit (y & 7) de l'octet
+    x * row_stride + (y >> 3) (poids faible en premier). Les bits de
+    bourrage en fin de ligne sont toujours à 0, ce qui permet aux
+    helpers mot à mot de travailler octet par octet sans cas limite.
+
+    Les helpers exposés (row_bits, window3, next_set_bit, runs)
+    permettent aux algorithmes de tester plusieurs voisins d'un coup,
+    de sauter les plages de fond octet par octet et d'extraire les runs
+    d'une ligne sans boucle par pixel.
+    """
+
+    def __init__(self, width: int = 0, height: int = 0):
+        """
+        Constructeur avec dimensions (tous les bits à 0).
+
+        Args:
+            width: Largeur de l'image
+            height: Hauteur de l'image
+        """
+        self._width = width
+        self._height = height
+        self._row_stride = (width + 7) >> 3
+
+        if width > 0 and height > 0:
+            self._buffer = bytearray(self._row_stride * height)
+        else:
+            self._buffer = bytearray()
+
+    @classmethod
+    def from_image(cls, image: 'Image') -> 'BitImage':
+        """
+        Packe une image binarisée (0 = fond, non nul = objet).
+
+        Args:
+            image: Image dont les pixels non nuls deviennent des bits à 1
+
+        Returns:
+            Nouvelle BitImage
+        """
+        bits = cls(image.width, image.height)
+        buf = bits._buffer
+        stride = bits._row_stride
+
+        for x in range(image.height):
+            row = image.row(x)
+            base = x * stride
+            for y in range(image.width):
+                if row[y]:
+                    buf[base + (y >> 3)] |= 1 << (y & 7)
+
+        return bits
+
+    @property
+    def width(self) -> int:
+        """Largeur de l'image."""
+        return self._width
+
+    @property
+    def height(self) -> int:
+        """Hauteur de l'image."""
+        return self._height
+
+    @property
+    def size(self) -> int:
+        """Nombre total de pixels."""
+        return self._width * self._height
+
+    @property
+    def row_stride(self) -> int:
+        """Nombre d'octets par ligne."""
+        return self._row_stride
+
+    @property
+    def buffer(self) -> bytearray:
+        """Accès direct au tampon packé (row_stride octets par ligne)."""
+        return self._buffer
+
+    def at(self, x: int, y: int) -> int:
+        """
+        Accès à un pixel (lecture).
+
+        Args:
+            x: Coordonnée ligne
+            y: Coordonnée colonne
+
+        Returns:
+            0 ou 1
+        """
+        if not self.is_valid(x, y):
+            raise IndexError("Coordonnées hors limites")
+        return (self._buffer[x * self._row_stride + (y >> 3)] >> (y & 7)) & 1
+
+    def set_at(self, x: int, y: int, value: int):
+        """
+        Définit la valeur d'un pixel.
+
+        Args:
+            x: Coordonnée ligne
+            y: Coordonnée colonne
+            value: 0 ou non nul (bit à 1)
+        """
+        if not self.is_valid(x, y):
+            raise IndexError("Coordonnées hors limites")
+        i = x * self._row_stride + (y >> 3)
+        if value:
+            self._buffer[i] |= 1 << (y & 7)
+        else:
+            self._buffer[i] &= ~(1 << (y & 7)) & 0xFF
+
+    def is_valid(self, x: int, y: int) -> bool:
+        """Vérifie si les coordonnées sont valides."""
+        return 0 <= x < self._height and 0 <= y < self._width
+
+    def row_bits(self, x: int, start: int, count: int) -> int:
+        """
+        Extrait count bits consécutifs d'une ligne en un seul entier.
+
+        Le bit i du résultat est le pixel (x, start + i) ; les colonnes
+        hors image valent 0 (start peut être négatif). Permet de tester
+        8 ou 16 voisins d'une ligne en une seule opération.
+
+        Args:
+            x: Coordonnée ligne
+            start: Première colonne (peut déborder de l'image)
+            count: Nombre de bits à extraire
+
+        Returns:
+            Entier de count bits
+        """
+        lo = start if start > 0 else 0
+        hi = start + count
+        if hi > self._width:
+            hi = self._width
+        if lo >= hi:
+            return 0
+
+        buf = self._buffer
+        base = x * self._row_stride
+        first_byte = lo >> 3
+        last_byte = (hi - 1) >> 3
+
+        word = 0
+        for i in range(first_byte, last_byte + 1):
+            word |= buf[base + i] << ((i - first_byte) << 3)
+
+        word >>= lo - (first_byte << 3)
+        word &= (1 << (hi - lo)) - 1
+        return word << (lo - start)
+
+    def window3(self, x: int, y: int) -> int:
+        """
+        Retourne le voisinage 3x3 du pixel (x, y) en un masque de 9 bits.
+
+        Disposition (bit 0 = poids faible) :
+            bits 0-2 : (x-1, y-1) (x-1, y) (x-1, y+1)
+            bits 3-5 : (x,   y-1) (x,   y) (x,   y+1)
+            bits 6-8 : (x+1, y-1) (x+1, y) (x+1, y+1)
+        Les positions hors image valent 0.
+
+        Args:
+            x: Coordonnée ligne
+            y: Coordonnée colonne
+
+        Returns:
+            Masque de 9 bits
+        """
+        mask = 0
+        if x > 0:
+            mask = self.row_bits(x - 1, y - 1, 3)
+        mask |= self.row_bits(x, y - 1, 3) << 3
+        if x < self._height - 1:
+            mask |= self.row_bits(x + 1, y - 1, 3) << 6
+        return mask
+
+    def next_set_bit(self, x: int, y: int) -> int:
+        """
+        Trouve le prochain pixel objet d'une ligne.
+
+        Les octets entièrement à 0 sont sautés d'un coup : sur une image
+        dominée par le fond, le balayage avance 8 colonnes par itération.
+
+        Args:
+            x: Coordonnée ligne
+            y: Première colonne candidate
+
+        Returns:
+            Colonne du prochain bit à 1 (>= y), ou -1 s'il n'y en a plus
+        """
+        if y >= self._width:
+            return -1
+        if y < 0:
+            y = 0
+
+        buf = self._buffer
+        base = x * self._row_stride
+        byte_i = y >> 3
+
+        b = buf[base + byte_i] >> (y & 7)
+        if b:
+            return y + ((b & -b).bit_length() - 1)
+
+        for i in range(byte_i + 1, self._row_stride):
+            b = buf[base + i]
+            if b:
+                return (i << 3) + ((b & -b).bit_length() - 1)
+
+        return -1
+
+    def runs(self, x: int) -> List[Tuple[int, int]]:
+        """
+        Extrait les runs horizontaux maximaux d'une ligne.
+
+        Le balayage alterne recherche du prochain bit à 1 et du prochain
+        bit à 0, octet par octet (les plages 0x00 et 0xFF sont sautées
+        d'un coup) : le coût est proportionnel au nombre d'octets, pas
+        au nombre de pixels.
+
+        Args:
+            x: Coordonnée ligne
+
+        Returns:
+            Liste de (y_début, y_fin) avec y_fin exclus
+        """
+        runs = []
+        width = self._width
+        y = self.next_set_bit(x, 0)
+        while y != -1:
+            end = self._next_clear_bit(x, y)
+            if end > width:
+                end = width
+            runs.append((y, end))
+            if end >= width:
+                break
+            y = self.next_set_bit(x, end)
+        return runs
+
+    def _next_clear_bit(self, x: int, y: int) -> int:
+        """
+        Trouve le prochain bit à 0 d'une ligne (>= y).
+
+        Peut retourner une colonne dans le bourrage de fin de ligne
+        (toujours à 0) : l'appelant doit borner le résultat à width.
+        """
+        buf = self._buffer
+        base = x * self._row_stride
+        byte_i = y >> 3
+
+        b = (~buf[base + byte_i] & 0xFF) >> (y & 7)
+        if b:
+            return y + ((b & -b).bit_length() - 1)
+
+        for i in range(byte_i + 1, self._row_stride):
+            b = ~buf[base + i] & 0xFF
+            if b:
+                return (i << 3) + ((b & -b).bit_length() - 1)
+
+        return self._row_stride << 3
+
+    def to_image(self) -> 'Image':
+        """
+        Dépacke vers une Image 8 bits (bits à 1 -> 255).
+
+        Returns:
+            Nouvelle Image binaire équivalente
+        """
+        image = Image(self._width, self._height)
+        out = image.buffer
+        for x in range(self._height):
+            base = x * self._width
+            for start, end in self.runs(x):
+                out[base + start:base + end] = b'\xff' * (end - start)
+        return image
+
+
 class LabelImage:
     """
     Classe pour une image d'étiquettes (labels).
 
     Utilisée pour stocker le résultat de la labellisation.
-    Utilise des entiers Python pour supporter un grand nombre de labels.
+    Les labels sont stockés dans un array('i') plat row-major
+    (entier signé 32 bits par pixel, index = x * width + y).
     """
 
     def __init__(self, width: int = 0, height: int = 0):
@@ -217,9 +586,11 @@ class LabelImage:
         self._height = height
 
         if width > 0 and height > 0:
-            self._labels = [[0 for _ in range(width)] for _ in range(height)]
+            self._labels = array('i', [0]) * (width * height)
         else:
-            self._labels = []
+            self._labels = array('i')
+
+        self._num_components = None
 
     @property
     def width(self) -> int:
@@ -237,20 +608,98 @@ class LabelImage:
         return self._width * self._height
 
     @property
-    def data(self) -> List[List[int]]:
-        """Accès direct aux labels."""
+    def buffer(self) -> array:
+        """
+        Accès direct au tampon plat row-major (array('i')).
+
+        C'est le stockage réel des labels : les boucles critiques peuvent
+        l'indexer directement (index = x * width + y).
+        """
         return self._labels
 
+    @property
+    def num_components(self) -> Optional[int]:
+        """
+        Nombre de composantes connexes, si connu (cache).
+
+        Les algorithmes de labellisation le renseignent à partir du
+        compteur de labels qu'ils maintiennent déjà : count_labels()
+        n'a alors plus besoin de rebalayer l'image. Vaut None si aucun
+        algorithme ne l'a renseigné.
+
+        Le code qui modifie les labels après labellisation doit le
+        remettre à None (cache invalide).
+        """
+        return self._num_components
+
+    @num_components.setter
+    def num_components(self, value: Optional[int]):
+        """Renseigne (ou invalide avec None) le nombre de composantes."""
+        self._num_components = value
+
+    @property
+    def data(self) -> List[List[int]]:
+        """
+        Vue liste 2D des labels (compatibilité).
+
+        Construit une copie liste-de-listes du tampon plat. À réserver
+        au code non critique.
+        """
+        width = self._width
+        return [list(self._labels[x * width:(x + 1) * width])
+                for x in range(self._height)]
+
     @data.setter
     def data(self, value: List[List[int]]):
-        """Définit les données de labels."""
-        self._labels = value
+        """Définit les données de labels depuis une liste 2D."""
         if value and len(value) > 0:
             self._height = len(value)
             self._width = len(value[0]) if value[0] else 0
+            self._labels = array('i', [0]) * (self._width * self._height)
+            width = self._width
+            for x in range(self._height):
+                self._labels[x * width:(x + 1) * width] = array('i', value[x])
         else:
             self._height = 0
             self._width = 0
+            self._labels = array('i')
+        self._num_components = None
+
+    def adopt_buffer(self, buffer, width: int, height: int):
+        """
+        Adopte un tampon plat de labels existant sans copie.
+
+        Utilisé par le rechargement du format .lab : le raster mappé en
+        mémoire est adopté tel quel (memoryview castée en entiers 32
+        bits) au lieu d'être recopié dans un array.
+
+        Args:
+            buffer: Objet exposant width * height entiers 32 bits
+                    (array('i') ou memoryview castée en 'i')
+            width: Largeur de l'image
+            height: Hauteur de l'image
+        """
+        if len(buffer) != width * height:
+            raise ValueError("Taille du tampon incompatible avec les dimensions")
+        self._labels = buffer
+        self._width = width
+        self._height = height
+        self._num_components = None
+
+    def row(self, x: int) -> memoryview:
+        """
+        Retourne une memoryview sur la ligne x (sans copie).
+
+        Args:
+            x: Coordonnée ligne
+
+        Returns:
+            memoryview sur les labels de la ligne
+        """
+        if x < 0 or x >= self._height:
+            raise IndexError("Ligne hors limites")
+        start = x * self._width
+        return memoryview(self._labels)[start:start + self._width]
 
     def at(self, x: int, y: int) -> int:
         """
@@ -265,7 +714,7 @@ class LabelImage:
         """
         if not self.is_valid(x, y):
             raise IndexError("Coordonnées hors limites")
-        return self._labels[x][y]
+        return self._labels[x * self._width + y]
 
     def set_at(self, x: int, y: int, value: int):
         """
@@ -278,7 +727,7 @@ class LabelImage:
         """
         if not self.is_valid(x, y):
             raise IndexError("Coordonnées hors limites")
-        self._labels[x][y] = value
+        self._labels[x * self._width + y] = value
 
     def is_valid(self, x: int, y: int) -> bool:
         """
@@ -300,53 +749,56 @@ class LabelImage:
         Args:
             value: Valeur à affecter à tous les labels
         """
-        for x in range(self._height):
-            for y in range(self._width):
-                self._labels[x][y] = value
+        self._labels[:] = array('i', [value]) * (self._width * self._height)
+        self._num_components = None
 
     def count_labels(self) -> int:
         """
         Compte le nombre de labels distincts (hors 0).
 
+        Si un algorithme a renseigné num_components, le cache est
+        retourné directement ; sinon l'image est balayée (et le
+        résultat mis en cache).
+
         Returns:
             Nombre de composantes connexes
         """
+        if self._num_components is not None:
+            return self._num_components
+
         seen = set()
-        for x in range(self._height):
-            for y in range(self._width):
-                label = self._labels[x][y]
-                if label > 0:
-                    seen.add(label)
-        return len(seen)
+        for label in self._labels:
+            if label > 0:
+                seen.add(label)
+        self._num_components = len(seen)
+        return self._num_components
 
     def to_visualization(self) -> Image:
         """
         Normalise les labels pour la visualisation.
         Remappe les labels sur [0, 255] pour sauvegarder au format PGM.
 
+        La correspondance label -> niveau de gris est précalculée dans
+        une table plate (une entrée par label) : la peinture se réduit
+        à une indexation de table par pixel.
+
         Returns:
             Image 8-bit avec labels normalisés
         """
         result = Image(self._width, self._height)
 
-        max_label = 0
-        for x in range(self._height):
-            for y in range(self._width):
-                if self._labels[x][y] > max_label:
-                    max_label = self._labels[x][y]
-
+        max_label = max(self._labels, default=0)
         if max_label == 0:
-            result.fill(0)
             return result
 
-        for x in range(self._height):
-            for y in range(self._width):
-                label = self._labels[x][y]
-                if label == 0:
-                    result.set_at(x, y, 0)
-                else:
-                    value = ((label * 254) // max_label) + 1
-                    result.set_at(x, y, value)
+        # Table label -> niveau de gris (label 0 = fond = 0)
+        lut = bytearray(max_label + 1)
+        for label in range(1, max_label + 1):
+            lut[label] = ((label * 254) // max_label) + 1
+
+        out = result.buffer
+        for i, label in enumerate(self._labels):
+            out[i] = lut[label]
 
         return result
 
@@ -358,22 +810,23 @@ class LabelImage:
         La génération utilise des nombres premiers pour une bonne distribution
         des couleurs, avec une valeur minimale de 55 pour éviter le noir.
 
+        Les couleurs sont précalculées dans une table plate (3 octets
+        par label) puis peintes par copie de tranches dans le tampon
+        packé de ColorImage : aucun tuple ni dictionnaire par pixel.
+
         Returns:
             ColorImage avec couleurs distinctes pour chaque label
         """
         result = ColorImage(self._width, self._height)
 
-        unique_labels = set()
-        for x in range(self._height):
-            for y in range(self._width):
-                if self._labels[x][y] > 0:
-                    unique_labels.add(self._labels[x][y])
-
-        if not unique_labels:
+        max_label = max(self._labels, default=0)
+        if max_label == 0:
             return result
 
-        color_lut = {}
-        for label in unique_labels:
+        # Table plate label -> (B, G, R) (ordre packé de ColorImage),
+        # label 0 = fond = noir
+        lut = bytearray(3 * (max_label + 1))
+        for label in range(1, max_label + 1):
             r = ((label * 67) % 200) + 55
             g = ((label * 97) % 200) + 55
             b = ((label * 131) % 200) + 55
@@ -387,15 +840,17 @@ class LabelImage:
                 else:
                     b = 200
 
-            color_lut[label] = (r, g, b)
+            base = 3 * label
+            lut[base] = b
+            lut[base + 1] = g
+            lut[base + 2] = r
 
-        for x in range(self._height):
-            for y in range(self._width):
-                label = self._labels[x][y]
-                if label == 0:
-                    result.set_at(x, y, (0, 0, 0))
-                else:
-                    result.set_at(x, y, color_lut[label])
+        out = result.buffer
+        for i, label in enumerate(self._labels):
+            if label != 0:
+                base = 3 * label
+                j = 3 * i
+                out[j:j + 3] = lut[base:base + 3]
 
         return result
 
@@ -405,15 +860,23 @@ class ColorImage:
     Classe pour une image couleur RGB.
 
     Utilisée pour la visualisation des labels avec des couleurs distinctes.
+
+    Les pixels sont stockés dans un bytearray plat packé (3 octets B, G, R
+    par pixel, row-major) : le pixel (x, y) occupe les octets
+    [3 * (x * width + y), 3 * (x * width + y) + 3). L'ordre des canaux
+    est celui d'OpenCV (BGR) : numpy peut envelopper le tampon sans
+    copie (np.frombuffer(...).reshape(height, width, 3)) et le passer
+    tel quel à cv2.imwrite. Les accesseurs at()/set_at() restent en
+    tuples (R, G, B).
     """
 
     def __init__(self, width: int = 0, height: int = 0):
         self._width = width
         self._height = height
         if width > 0 and height > 0:
-            self._data = [[(0, 0, 0) for _ in range(width)] for _ in range(height)]
+            self._buffer = bytearray(3 * width * height)
         else:
-            self._data = []
+            self._buffer = bytearray()
 
     @property
     def width(self) -> int:
@@ -423,17 +886,132 @@ class ColorImage:
     def height(self) -> int:
         return self._height
 
+    @property
+    def buffer(self) -> bytearray:
+        """
+        Accès direct au tampon plat packé (3 octets B, G, R par pixel).
+        """
+        return self._buffer
+
+    def to_rgb_bytes(self) -> bytearray:
+        """
+        Retourne le raster packé en ordre R, G, B (copie).
+
+        Les canaux sont permutés par affectations de tranches (opérations
+        C sur le tampon entier), jamais pixel par pixel. Utilisé par les
+        écrivains de formats RGB (PPM).
+
+        Returns:
+            bytearray de 3 * width * height octets, ordre R, G, B
+        """
+        buf = self._buffer
+        rgb = bytearray(buf)
+        rgb[0::3] = buf[2::3]
+        rgb[2::3] = buf[0::3]
+        return rgb
+
     @property
     def data(self):
-        return self._data
+        """
+        Vue liste 2D de tuples (R, G, B) (compatibilité).
+
+        Construit une copie liste-de-listes du tampon packé. À réserver
+        au code non critique : les boucles chaudes doivent utiliser
+        `buffer`.
+        """
+        buf = self._buffer
+        width = self._width
+        return [[(buf[i + 2], buf[i + 1], buf[i])
+                 for i in range(3 * x * width, 3 * (x + 1) * width, 3)]
+                for x in range(self._height)]
 
     def at(self, x: int, y: int) -> tuple:
         """Retourne le tuple (R, G, B) du pixel."""
-        return self._data[x][y]
+        i = 3 * (x * self._width + y)
+        return (self._buffer[i + 2], self._buffer[i + 1], self._buffer[i])
 
     def set_at(self, x: int, y: int, rgb: tuple):
         """Définit le tuple (R, G, B) du pixel."""
-        self._data[x][y] = rgb
+        i = 3 * (x * self._width + y)
+        self._buffer[i:i + 3] = bytes((rgb[2], rgb[1], rgb[0]))
 
     def is_valid(self, x: int, y: int) -> bool:
         return 0 <= x < self._height and 0 <= y < self._width
+
+
+class ImageVolume:
+    """
+    Pile de coupes 2D formant un volume (ex. coupes CT).
+
+    Les coupes sont des Image binaires de dimensions identiques,
+    indexées par z dans l'ordre de la pile. Le volume référence les
+    coupes telles quelles, sans copie : la mémoire reste celle des
+    coupes elles-mêmes.
+
+    Construction depuis un répertoire ou un motif glob :
+    voir ImageIO.read_volume.
+    """
+
+    def __init__(self, slices):
+        """
+        Initialise le volume à partir d'une liste de coupes.
+
+        Args:
+            slices: Liste d'Image de dimensions identiques (z croissant)
+
+        Raises:
+            ValueError: Si la liste est vide ou les dimensions diffèrent
+        """
+        if not slices:
+            raise ValueError("Un volume doit contenir au moins une coupe")
+
+        width = slices[0].width
+        height = slices[0].height
+        for image in slices[1:]:
+            if image.width != width or image.height != height:
+                raise ValueError(
+                    "Toutes les coupes doivent avoir les memes dimensions")
+
+        self._slices = list(slices)
+        self._width = width
+        self._height = height
+
+    @property
+    def width(self) -> int:
+        """Largeur des coupes."""
+        return self._width
+
+    @property
+    def height(self) -> int:
+        """Hauteur des coupes."""
+        return self._height
+
+    @property
+    def depth(self) -> int:
+        """Nombre de coupes (dimension z)."""
+        return len(self._slices)
+
+    @property
+    def size(self) -> int:
+        """Nombre total de voxels."""
+        return self._width * self._height * len(self._slices)
+
+    def slice(self, z: int) -> Image:
+        """
+        Retourne la coupe d'indice z (sans copie).
+
+        Args:
+            z: Indice de la coupe
+
+        Returns:
+            Image de la coupe
+        """
+        if z < 0 or z >= len(self._slices):
+            raise IndexError("Coupe hors limites")
+        return self._slices[z]
+
+    def __len__(self) -> int:
+        return len(self._slices)
+
+    def __iter__(self):
+        return iter(self._slices)
\ No newline at end of file
@@ -9,16 +9,23 @@ Ce programme implémente 4 algorithmes différents :
 4. Prim : Approche par graphe (exploration BFS)
 
 Usage :
-  python main.py <input> <output> <algorithm> <connectivity>
+  python main.py <input> <output> <algorithm> <connectivity> [--stats]
+  python main.py --batch <input_dir> <output_dir> <algorithm> <connectivity>
 
 Arguments :
   input        : Chemin de l'image d'entree (JPEG, PNG, BMP, PGM, PPM, etc.)
   output       : Chemin de l'image de sortie (PGM, PNG, JPEG, etc.)
-  algorithm    : two_pass | union_find | kruskal | prim
+  algorithm    : two_pass | union_find | kruskal | prim | rle
   connectivity : 4 | 8
 
+Le mode --batch parcourt le répertoire d'entrée et alimente le pipeline
+à trois étages de pipeline.py (décodage, labellisation, encodage dans
+des processus séparés reliés par des files bornées) : les entrées/
+sorties et le calcul se recouvrent au lieu de s'additionner.
+
 Exemple :
   python main.py input.jpg output.png two_pass 4
+  python main.py --batch scans/ resultats/ rle 8
 
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
@@ -35,23 +42,146 @@ from algorithms.two_pass import TwoPass
 from algorithms.union_find import UnionFind
 from algorithms.kruskal import Kruskal
 from algorithms.prim import Prim
-from utils.utils import Timer
+from algorithms.rle import RunLength
+from algorithms.parallel import ParallelLabeler
+from algorithms import counters, NATIVE_BACKEND
+from utils.utils import Timer, histogram, otsu_threshold
+from utils.result_cache import ResultCache
+
+
+VALID_ALGORITHMS = ("two_pass", "union_find", "kruskal", "prim", "rle")
+
+# Extensions prises en charge par le mode batch
+BATCH_EXTENSIONS = {'.pgm', '.ppm', '.jpg', '.jpeg', '.png', '.bmp',
+                    '.tiff', '.tif', '.gif', '.webp'}
 
 
 def print_usage(program_name: str) -> None:
     """Affiche l'aide d'utilisation."""
-    print(f"\nUsage: python {program_name} <input> <output> <algorithm> <connectivity>\n")
+    print(f"\nUsage: python {program_name} <input> <output> <algorithm> <connectivity>")
+    print(f"       python {program_name} --batch <input_dir> <output_dir> <algorithm> <connectivity>\n")
     print("Arguments:")
     print("  input        : Chemin de l'image d'entree (JPEG, PNG, BMP, PGM, PPM, etc.)")
     print("  output       : Chemin de l'image de sortie (PGM, PNG, JPEG, etc.)")
-    print("  algorithm    : two_pass | union_find | kruskal | prim")
+    print("                 ou .lab pour les labels bruts (sans perte)")
+    print("  algorithm    : two_pass | union_find | kruskal | prim | rle")
+    print("                 ou parallel:<algo> pour la version multi-coeurs")
     print("  connectivity : 4 | 8\n")
+    print("Options:")
+    print("  --stats      : affiche les compteurs d'operations (find/unite,")
+    print("                 collisions, spans enfiles) dans le resume final")
+    print("  --no-cache   : recalcule meme si le resultat est deja en cache")
+    print("  --threshold N: seuil de binarisation, 0-255 (defaut: 128),")
+    print("                 ou 'otsu' pour un seuil automatique\n")
     print("Formats supportes: JPEG, PNG, BMP, TIFF, GIF, WEBP, PGM, PPM\n")
     print("Exemples:")
     print(f"  python {program_name} input.jpg output.png two_pass 4")
     print(f"  python {program_name} input.png output.pgm union_find 8")
     print(f"  python {program_name} image.bmp result.png kruskal 4")
-    print(f"  python {program_name} photo.jpeg output.pgm prim 8\n")
+    print(f"  python {program_name} photo.jpeg output.pgm prim 8")
+    print(f"  python {program_name} scan.png output.png parallel:two_pass 4\n")
+
+
+def is_valid_algorithm(algorithm: str) -> bool:
+    """Vérifie un nom d'algorithme (simple ou parallel:<base>)."""
+    if algorithm.startswith("parallel:"):
+        return algorithm.split(":", 1)[1] in VALID_ALGORITHMS
+    return algorithm in VALID_ALGORITHMS
+
+
+def label_image(algorithm: str, input_image: Image, connectivity: int) -> LabelImage:
+    """
+    Exécute l'algorithme de labellisation demandé.
+
+    Args:
+        algorithm: Nom de l'algorithme (ou parallel:<base>)
+        input_image: Image binaire
+        connectivity: Connectivité (4 ou 8)
+
+    Returns:
+        Image labellisée
+    """
+    if algorithm.startswith("parallel:"):
+        base = algorithm.split(":", 1)[1]
+        return ParallelLabeler(base).label(input_image, connectivity)
+    if algorithm == "two_pass":
+        return TwoPass.label(input_image, connectivity)
+    if algorithm == "union_find":
+        return UnionFind.label(input_image, connectivity)
+    if algorithm == "kruskal":
+        return Kruskal.label(input_image, connectivity)
+    if algorithm == "prim":
+        return Prim.label(input_image, connectivity)
+    if algorithm == "rle":
+        return RunLength.label(input_image, connectivity)
+    raise ValueError(f"Algorithme inconnu: {algorithm}")
+
+
+def run_batch(input_dir: str, output_dir: str,
+              algorithm: str, connectivity: int,
+              threshold: int = 128) -> int:
+    """
+    Mode batch : labellise toutes les images d'un répertoire avec le
+    pipeline à trois étages (décodage, labellisation, encodage).
+
+    Les étages tournent dans des processus séparés reliés par des files
+    bornées (voir pipeline.py) : le disque et le CPU travaillent en
+    même temps au lieu d'additionner leurs latences par image.
+
+    Args:
+        input_dir: Répertoire des images d'entrée
+        output_dir: Répertoire de sortie (créé si besoin)
+        algorithm: Nom de l'algorithme
+        connectivity: Connectivité (4 ou 8)
+        threshold: Seuil de binarisation appliqué au décodage
+
+    Returns:
+        Code de retour (0 = succès)
+    """
+    from pipeline import BatchPipeline
+
+    if not os.path.isdir(input_dir):
+        print(f"Erreur: repertoire introuvable: {input_dir}", file=sys.stderr)
+        return 1
+
+    files = sorted(
+        name for name in os.listdir(input_dir)
+        if os.path.splitext(name)[1].lower() in BATCH_EXTENSIONS)
+
+    if not files:
+        print(f"Aucune image trouvee dans {input_dir}", file=sys.stderr)
+        return 1
+
+    os.makedirs(output_dir, exist_ok=True)
+
+    tasks = [(os.path.join(input_dir, name),
+              os.path.join(output_dir, name))
+             for name in files]
+
+    batch = BatchPipeline(algorithm, connectivity, threshold)
+    print(f"Batch: {len(tasks)} images, pipeline "
+          f"{batch.num_decoders} decodeurs + {batch.num_labelers} "
+          f"labelliseurs + {batch.num_encoders} encodeurs "
+          f"({algorithm}, connectivite {connectivity})\n")
+
+    total_timer = Timer()
+    total_timer.start()
+    num_errors = 0
+
+    for name, elapsed, num_components, error in batch.run(tasks):
+        if error is not None:
+            num_errors += 1
+            print(f"  ECHEC  {name}: {error}", file=sys.stderr)
+        else:
+            print(f"  OK     {name}: {elapsed:.2f} ms, "
+                  f"{num_components} composantes")
+
+    total_ms = total_timer.stop()
+    print(f"\n{len(tasks) - num_errors}/{len(tasks)} images traitees "
+          f"en {total_ms:.0f} ms "
+          f"({len(tasks) * 1000.0 / total_ms:.1f} images/s)")
+
+    return 1 if num_errors else 0
 
 
 def main():
@@ -60,6 +190,56 @@ def main():
     print("  Labellisation des Composantes Connexes")
     print("========================================\n")
 
+    # Option --stats : compteurs d'operations dans le resume final
+    show_stats = "--stats" in sys.argv
+    if show_stats:
+        sys.argv.remove("--stats")
+
+    # Option --no-cache : desactive le cache de resultats
+    use_cache = "--no-cache" not in sys.argv
+    if not use_cache:
+        sys.argv.remove("--no-cache")
+
+    # Option --threshold N|otsu : seuil de binarisation (defaut: 128)
+    threshold = 128
+    auto_threshold = False
+    if "--threshold" in sys.argv:
+        idx = sys.argv.index("--threshold")
+        if idx + 1 >= len(sys.argv):
+            print("Erreur: --threshold attend une valeur", file=sys.stderr)
+            return 1
+        value = sys.argv[idx + 1]
+        if value.lower() == "otsu":
+            auto_threshold = True
+        else:
+            try:
+                threshold = int(value)
+            except ValueError:
+                print("Erreur: seuil invalide (entier ou 'otsu' attendu)",
+                      file=sys.stderr)
+                return 1
+            if not 0 <= threshold <= 255:
+                print("Erreur: le seuil doit etre entre 0 et 255", file=sys.stderr)
+                return 1
+        del sys.argv[idx:idx + 2]
+
+    # Mode batch : --batch <input_dir> <output_dir> <algorithm> <connectivity>
+    if len(sys.argv) == 6 and sys.argv[1] == "--batch":
+        algorithm = sys.argv[4]
+        if not is_valid_algorithm(algorithm):
+            print("Erreur: algorithme invalide", file=sys.stderr)
+            print_usage(sys.argv[0])
+            return 1
+        try:
+            connectivity = int(sys.argv[5])
+        except ValueError:
+            connectivity = 0
+        if connectivity not in (4, 8):
+            print("Erreur: la connectivite doit etre 4 ou 8", file=sys.stderr)
+            return 1
+        return run_batch(sys.argv[2], sys.argv[3], algorithm, connectivity,
+                         threshold)
+
     # Vérifier les arguments
     if len(sys.argv) != 5:
         print("Erreur: nombre d'arguments incorrect", file=sys.stderr)
@@ -80,8 +260,7 @@ def main():
         print("Erreur: la connectivite doit etre 4 ou 8", file=sys.stderr)
         return 1
 
-    valid_algorithms = ("two_pass", "union_find", "kruskal", "prim")
-    if algorithm not in valid_algorithms:
+    if not is_valid_algorithm(algorithm):
         print("Erreur: algorithme invalide", file=sys.stderr)
         print_usage(sys.argv[0])
         return 1
@@ -93,19 +272,26 @@ def main():
     print(f"Chargement de l'image: {input_file}")
 
     try:
-        # Lecture automatique du format (JPEG, PNG, BMP, PGM, PPM, etc.)
-        input_image = ImageIO.read_image(input_file)
-        print("  -> Image chargee et convertie en niveaux de gris")
+        if auto_threshold:
+            # Seuil d'Otsu : il faut les niveaux de gris pour
+            # l'histogramme, la binarisation suit (un passage translate)
+            input_image = ImageIO.read_image(input_file)
+            threshold = otsu_threshold(histogram(input_image.buffer))
+            input_image.binarize(threshold)
+            print(f"  -> Image chargee, seuil d'Otsu: {threshold}")
+        else:
+            # Lecture automatique du format (JPEG, PNG, BMP, PGM, PPM,
+            # etc.) avec binarisation fusionnee dans le decodage :
+            # l'intermediaire en niveaux de gris n'est jamais materialise
+            input_image = ImageIO.read_image(input_file, threshold)
+            print("  -> Image chargee et binarisee au decodage")
     except Exception as e:
         print(f"Erreur lors du chargement: {e}", file=sys.stderr)
         return 1
 
     print(f"  Dimensions: {input_image.width} x {input_image.height}")
-    print(f"  Pixels: {input_image.size}\n")
-
-    # Binariser l'image (seuil à 128)
-    input_image.binarize(128)
-    print("Image binarisee (seuil = 128)\n")
+    print(f"  Pixels: {input_image.size}")
+    print(f"  Seuil de binarisation: {threshold}\n")
 
     # ========================================================================
     # Étape 2 : Labellisation
@@ -113,23 +299,38 @@ def main():
 
     print(f"Algorithme: {algorithm}")
     print(f"Connectivite: {connectivity}")
+    print("Backend: " + ("noyaux natifs (_labeling)" if NATIVE_BACKEND
+                         else "Python pur"))
     print("Labellisation en cours...")
 
+    op_counters = counters.enable() if show_stats else None
+
+    # Cache de resultats adresse par contenu : si ce raster binarise a
+    # deja ete labellise avec cet algorithme et cette connectivite, le
+    # resultat .lab est recharge par mmap au lieu d'etre recalcule
+    cache = ResultCache() if use_cache else None
+    cache_key = None
+    labels = None
+
     timer = Timer()
     timer.start()
 
     try:
-        if algorithm == "two_pass":
-            labels = TwoPass.label(input_image, connectivity)
-        elif algorithm == "union_find":
-            labels = UnionFind.label(input_image, connectivity)
-        elif algorithm == "kruskal":
-            labels = Kruskal.label(input_image, connectivity)
-        elif algorithm == "prim":
-            labels = Prim.label(input_image, connectivity)
+        if cache is not None:
+            cache_key = ResultCache.key(input_image, algorithm, connectivity)
+            labels = cache.get(cache_key)
+
+        if labels is None:
+            labels = label_image(algorithm, input_image, connectivity)
+            if cache is not None:
+                cache.put(cache_key, labels)
+        else:
+            print("  -> Resultat trouve en cache (labellisation evitee)")
     except Exception as e:
         print(f"Erreur lors de la labellisation: {e}", file=sys.stderr)
         return 1
+    finally:
+        counters.disable()
 
     elapsed = timer.stop()
 
@@ -140,6 +341,12 @@ def main():
     print(f"  Temps d'execution: {elapsed:.2f} ms")
     print(f"  Composantes connexes trouvees: {num_components}\n")
 
+    if op_counters is not None:
+        print("Compteurs d'operations (chemin Python instrumente):")
+        for line in op_counters.summary_lines():
+            print(f"  {line}")
+        print()
+
     # ========================================================================
     # Étape 3 : Sauvegarde de l'image labellisée
     # ========================================================================
@@ -147,11 +354,16 @@ def main():
     print(f"Sauvegarde de l'image labellisee: {output_file}")
 
     try:
-        # Convertir en image visualisable (normalisation sur [0, 255])
-        output_image = labels.to_visualization()
-
-        # Sauvegarder (format detecte automatiquement selon l'extension)
-        ImageIO.write_image(output_file, output_image)
+        if output_file.lower().endswith('.lab'):
+            # Labels bruts : valeurs reelles conservees, meme au-dela
+            # de 254 composantes (rechargeables via ImageIO.read_lab)
+            ImageIO.write_lab(output_file, labels)
+        else:
+            # Convertir en image visualisable (normalisation sur [0, 255])
+            output_image = labels.to_visualization()
+
+            # Sauvegarder (format detecte automatiquement selon l'extension)
+            ImageIO.write_image(output_file, output_image)
 
         print("Image sauvegardee avec succes!")
     except Exception as e:
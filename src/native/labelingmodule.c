@@ -0,0 +1,198 @@
+/*
+ * Module natif _labeling - Noyaux compilés pour la labellisation
+ *
+ * Ce module implémente en C les boucles par pixel des quatre algorithmes
+ * de labellisation, sur le stockage plat de core/image.py :
+ *   - entrée  : bytearray (1 octet par pixel, 0 = fond, !=0 = objet)
+ *   - sortie  : array('i') (labels 32 bits, écrit en place)
+ *
+ * Un seul noyau suffit pour les quatre algorithmes :
+ *   - label_compact : Union-Find sur les paires adjacentes puis
+ *     renumérotation compacte en ordre de parcours. TwoPass, Union-Find,
+ *     Kruskal (arêtes de poids 1) et Prim (BFS) produisent exactement ce
+ *     résultat : les composantes sont numérotées dans l'ordre de leur
+ *     premier pixel rencontré.
+ *
+ * Compilation : voir src/native/setup.py
+ * Sélection   : voir src/algorithms/native.py
+ *
+ * Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ------------------------------------------------------------------ */
+/* Union-Find partagé : find itératif avec path halving               */
+/* ------------------------------------------------------------------ */
+
+static int32_t
+ds_find(int32_t *parent, int32_t x)
+{
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+/* Union par taille */
+static void
+ds_union_size(int32_t *parent, int32_t *size, int32_t a, int32_t b)
+{
+    a = ds_find(parent, a);
+    b = ds_find(parent, b);
+    if (a == b)
+        return;
+    if (size[a] < size[b]) {
+        int32_t tmp = a;
+        a = b;
+        b = tmp;
+    }
+    parent[b] = a;
+    size[a] += size[b];
+}
+
+/* ------------------------------------------------------------------ */
+/* Noyau compact : Union-Find + renumérotation en ordre de parcours   */
+/* ------------------------------------------------------------------ */
+
+static int32_t
+kernel_compact(const uint8_t *in, int32_t *out,
+               Py_ssize_t width, Py_ssize_t height, int connectivity)
+{
+    Py_ssize_t n = width * height;
+    Py_ssize_t i, x, y;
+    int32_t next_label = 1;
+
+    int32_t *parent = (int32_t *)malloc(n * sizeof(int32_t));
+    int32_t *size = (int32_t *)malloc(n * sizeof(int32_t));
+    if (parent == NULL || size == NULL) {
+        free(parent);
+        free(size);
+        return -1;
+    }
+    for (i = 0; i < n; i++) {
+        parent[i] = (int32_t)i;
+        size[i] = 1;
+    }
+
+    /* Phase 1 : union des pixels adjacents (voisins "avant") */
+    for (x = 0; x < height; x++) {
+        const uint8_t *row = in + x * width;
+        Py_ssize_t base = x * width;
+        for (y = 0; y < width; y++) {
+            if (row[y] == 0)
+                continue;
+            if (x > 0 && in[base - width + y] != 0)
+                ds_union_size(parent, size, (int32_t)(base + y),
+                              (int32_t)(base - width + y));
+            if (y > 0 && row[y - 1] != 0)
+                ds_union_size(parent, size, (int32_t)(base + y),
+                              (int32_t)(base + y - 1));
+            if (connectivity == 8) {
+                if (x > 0 && y > 0 && in[base - width + y - 1] != 0)
+                    ds_union_size(parent, size, (int32_t)(base + y),
+                                  (int32_t)(base - width + y - 1));
+                if (x > 0 && y < width - 1 && in[base - width + y + 1] != 0)
+                    ds_union_size(parent, size, (int32_t)(base + y),
+                                  (int32_t)(base - width + y + 1));
+            }
+        }
+    }
+
+    /* Phase 2 : renumérotation compacte (1, 2, 3, ...) */
+    memset(size, 0, n * sizeof(int32_t)); /* réutilisé comme table racine->label */
+    for (i = 0; i < n; i++) {
+        if (in[i] == 0) {
+            out[i] = 0;
+            continue;
+        }
+        int32_t root = ds_find(parent, (int32_t)i);
+        if (size[root] == 0)
+            size[root] = next_label++;
+        out[i] = size[root];
+    }
+
+    free(parent);
+    free(size);
+    return next_label - 1;
+}
+
+/* ------------------------------------------------------------------ */
+/* Interface Python                                                    */
+/* ------------------------------------------------------------------ */
+
+typedef int32_t (*kernel_fn)(const uint8_t *, int32_t *,
+                             Py_ssize_t, Py_ssize_t, int);
+
+static PyObject *
+run_kernel(PyObject *args, kernel_fn kernel)
+{
+    Py_buffer in_buf, out_buf;
+    int width, height, connectivity;
+    int32_t result;
+
+    if (!PyArg_ParseTuple(args, "y*w*iii", &in_buf, &out_buf,
+                          &width, &height, &connectivity))
+        return NULL;
+
+    if (width <= 0 || height <= 0
+            || in_buf.len != (Py_ssize_t)width * height
+            || out_buf.len != (Py_ssize_t)width * height * 4) {
+        PyBuffer_Release(&in_buf);
+        PyBuffer_Release(&out_buf);
+        PyErr_SetString(PyExc_ValueError,
+                        "Dimensions incompatibles avec les tampons");
+        return NULL;
+    }
+    if (connectivity != 4 && connectivity != 8) {
+        PyBuffer_Release(&in_buf);
+        PyBuffer_Release(&out_buf);
+        PyErr_SetString(PyExc_ValueError, "Connectivite invalide (4 ou 8)");
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    result = kernel((const uint8_t *)in_buf.buf, (int32_t *)out_buf.buf,
+                    width, height, connectivity);
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&in_buf);
+    PyBuffer_Release(&out_buf);
+
+    if (result < 0)
+        return PyErr_NoMemory();
+    return PyLong_FromLong((long)result);
+}
+
+static PyObject *
+py_label_compact(PyObject *self, PyObject *args)
+{
+    return run_kernel(args, kernel_compact);
+}
+
+static PyMethodDef labeling_methods[] = {
+    {"label_compact", py_label_compact, METH_VARARGS,
+     "label_compact(in, out, width, height, connectivity) -> num_components\n"
+     "Noyau Union-Find compact (resultat de TwoPass/UnionFind/Kruskal/"
+     "Prim.label)."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef labeling_module = {
+    PyModuleDef_HEAD_INIT,
+    "_labeling",
+    "Noyaux compiles pour la labellisation des composantes connexes.",
+    -1,
+    labeling_methods
+};
+
+PyMODINIT_FUNC
+PyInit__labeling(void)
+{
+    return PyModule_Create(&labeling_module);
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+"""
+Compilation du module natif _labeling (optionnel).
+
+Le module compilé accélère les boucles par pixel des quatre algorithmes
+(facteur ~50-100x sur les grandes images). Il est détecté automatiquement
+par src/algorithms/native.py ; en son absence, les versions Python pures
+restent utilisées.
+
+Compilation :
+  cd src/native
+  python setup.py build_ext --inplace
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+from setuptools import setup, Extension
+
+setup(
+    name="labellisation-native",
+    version="1.0.0",
+    ext_modules=[
+        Extension(
+            "_labeling",
+            sources=["labelingmodule.c"],
+            extra_compile_args=["-O3"],
+        )
+    ],
+)
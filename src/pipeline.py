@@ -0,0 +1,250 @@
+"""
+Module pipeline.py - Exécuteur batch en pipeline à trois étages
+
+Le mode batch à pool de workers traite chaque image séquentiellement
+dans son worker : lecture (liée au disque), labellisation (liée au CPU),
+écriture (liée au disque). Le disque attend pendant la labellisation et
+le CPU attend pendant les entrées/sorties.
+
+Ce module découpe le traitement en trois étages de processus reliés par
+des files bornées :
+
+  décodeurs  -->  file d'images  -->  labelliseurs  -->  file de
+  (lecture +     (tampons plats,      (algorithme        résultats
+  binarisation)   bornée)             sélectionné)       (bornée)
+                                                          |
+                                                          v
+                                                       encodeurs
+                                                       (visualisation +
+                                                        écriture en bloc)
+
+Les files bornées fournissent la contre-pression : un étage rapide se
+bloque au lieu d'accumuler des tampons, et la mémoire de pointe reste
+en O(taille des files). Disque et CPU travaillent en même temps : le
+débit tend vers min(bande passante disque, CPU agrégé) au lieu de la
+somme des latences par image.
+
+Les images circulent entre étages sous forme de tampons plats (bytes),
+c'est-à-dire exactement le format de core/image.py — l'adoption par
+adopt_buffer évite toute conversion à l'arrivée.
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+from multiprocessing import Process, Queue, cpu_count
+
+# Ajouter le répertoire courant au path pour les imports
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from core.image import Image, LabelImage
+from readers.image_io import ImageIO
+from utils.utils import Timer
+
+
+def _decode_worker(task_queue, image_queue, result_queue,
+                   threshold: int) -> None:
+    """
+    Étage 1 : lecture et binarisation fusionnée.
+
+    Consomme des tâches (input_path, output_path), lit chaque image avec
+    la binarisation au décodage et pousse le tampon plat vers l'étage de
+    labellisation. Les erreurs de lecture court-circuitent directement
+    vers la file de résultats.
+    """
+    while True:
+        task = task_queue.get()
+        if task is None:
+            break
+
+        input_path, output_path = task
+        name = os.path.basename(input_path)
+        timer = Timer()
+        timer.start()
+
+        try:
+            image = ImageIO.read_image(input_path, threshold)
+        except Exception as e:
+            result_queue.put((name, 0.0, 0, str(e)))
+            continue
+
+        image_queue.put((name, output_path, image.width, image.height,
+                         bytes(image.buffer), timer.stop()))
+
+
+def _label_worker(image_queue, label_queue, result_queue,
+                  algorithm: str, connectivity: int) -> None:
+    """
+    Étage 2 : labellisation.
+
+    Adopte chaque tampon plat reçu sans conversion, exécute l'algorithme
+    sélectionné et pousse le tampon de labels vers l'étage d'encodage.
+    """
+    # Import différé : évite l'import circulaire main -> pipeline -> main
+    from main import label_image
+
+    while True:
+        item = image_queue.get()
+        if item is None:
+            break
+
+        name, output_path, width, height, pixels, elapsed = item
+        timer = Timer()
+        timer.start()
+
+        try:
+            image = Image(0, 0)
+            image.adopt_buffer(bytearray(pixels), width, height)
+            labels = label_image(algorithm, image, connectivity)
+            num_components = labels.count_labels()
+        except Exception as e:
+            result_queue.put((name, 0.0, 0, str(e)))
+            continue
+
+        label_queue.put((name, output_path, width, height,
+                         labels.buffer.tobytes(), num_components,
+                         elapsed + timer.stop()))
+
+
+def _encode_worker(label_queue, result_queue) -> None:
+    """
+    Étage 3 : visualisation et écriture en bloc.
+
+    Reconstruit une LabelImage par adoption (memoryview castée, sans
+    copie) et la sérialise via les écritures en bloc de ImageIO.
+    """
+    while True:
+        item = label_queue.get()
+        if item is None:
+            break
+
+        name, output_path, width, height, raw, num_components, elapsed = item
+        timer = Timer()
+        timer.start()
+
+        try:
+            labels = LabelImage(0, 0)
+            labels.adopt_buffer(memoryview(raw).cast('i'), width, height)
+            labels.num_components = num_components
+            if output_path.lower().endswith('.lab'):
+                ImageIO.write_lab(output_path, labels)
+            else:
+                ImageIO.write_image(output_path, labels.to_visualization())
+        except Exception as e:
+            result_queue.put((name, 0.0, 0, str(e)))
+            continue
+
+        result_queue.put((name, elapsed + timer.stop(), num_components, None))
+
+
+class BatchPipeline:
+    """
+    Pipeline batch à trois étages (décodage, labellisation, encodage).
+
+    Les étages liés aux entrées/sorties reçoivent peu de processus, la
+    labellisation reçoit le reste des cœurs. Le temps rapporté par image
+    est la somme de ses temps de traitement dans les trois étages (les
+    attentes en file n'y figurent pas).
+    """
+
+    def __init__(self, algorithm: str, connectivity: int,
+                 threshold: int = 128, num_workers: int = 0):
+        """
+        Args:
+            algorithm: Nom de l'algorithme (ou parallel:<base>)
+            connectivity: Connectivité (4 ou 8)
+            threshold: Seuil de binarisation appliqué au décodage
+            num_workers: Budget total de processus (0 = nombre de cœurs)
+        """
+        total = num_workers if num_workers > 0 else cpu_count()
+
+        # Les étages I/O saturent vite : deux processus chacun suffisent,
+        # le reste du budget va à l'étage CPU
+        self._num_decoders = max(1, min(2, total - 1))
+        self._num_encoders = max(1, min(2, total - 1))
+        self._num_labelers = max(1, total - self._num_decoders
+                                 - self._num_encoders)
+
+        self._algorithm = algorithm
+        self._connectivity = connectivity
+        self._threshold = threshold
+
+    @property
+    def num_decoders(self) -> int:
+        """Nombre de processus de l'étage de décodage."""
+        return self._num_decoders
+
+    @property
+    def num_labelers(self) -> int:
+        """Nombre de processus de l'étage de labellisation."""
+        return self._num_labelers
+
+    @property
+    def num_encoders(self) -> int:
+        """Nombre de processus de l'étage d'encodage."""
+        return self._num_encoders
+
+    def run(self, tasks):
+        """
+        Exécute le pipeline sur une liste de tâches.
+
+        Chaque tâche produit exactement un résultat, quel que soit
+        l'étage où elle aboutit ou échoue ; les résultats sont produits
+        dans leur ordre d'achèvement.
+
+        Args:
+            tasks: Liste de tuples (input_path, output_path)
+
+        Yields:
+            Tuples (nom, temps_ms, nb_composantes, erreur ou None)
+        """
+        # Files bornées entre étages : la contre-pression limite le
+        # nombre de tampons simultanément en vol
+        task_queue = Queue()
+        image_queue = Queue(maxsize=2 * self._num_labelers)
+        label_queue = Queue(maxsize=2 * self._num_encoders)
+        result_queue = Queue()
+
+        decoders = [Process(target=_decode_worker,
+                            args=(task_queue, image_queue, result_queue,
+                                  self._threshold))
+                    for _ in range(self._num_decoders)]
+        labelers = [Process(target=_label_worker,
+                            args=(image_queue, label_queue, result_queue,
+                                  self._algorithm, self._connectivity))
+                    for _ in range(self._num_labelers)]
+        encoders = [Process(target=_encode_worker,
+                            args=(label_queue, result_queue))
+                    for _ in range(self._num_encoders)]
+
+        for process in decoders + labelers + encoders:
+            process.start()
+
+        for task in tasks:
+            task_queue.put(task)
+
+        try:
+            # Un résultat par tâche : une fois tous reçus, les files
+            # intermédiaires sont vides et l'arrêt ne peut pas bloquer
+            for _ in range(len(tasks)):
+                yield result_queue.get()
+        finally:
+            self._shutdown(task_queue, image_queue, label_queue,
+                           decoders, labelers, encoders)
+
+    def _shutdown(self, task_queue, image_queue, label_queue,
+                  decoders, labelers, encoders) -> None:
+        """Arrête les trois étages (une sentinelle par processus)."""
+        for _ in decoders:
+            task_queue.put(None)
+        for process in decoders:
+            process.join()
+        for _ in labelers:
+            image_queue.put(None)
+        for process in labelers:
+            process.join()
+        for _ in encoders:
+            label_queue.put(None)
+        for process in encoders:
+            process.join()
@@ -2,23 +2,42 @@
 Module io/image_io.py - Lecture et écriture d'images
 
 Supporte les formats :
-- PGM/PPM (lecture native)
+- PGM/PPM (lecture native par mmap, sans dépendance)
 - JPEG, PNG, BMP, TIFF, etc. (via OpenCV)
 
-IMPORTANT: numpy/OpenCV sont utilisés UNIQUEMENT pour charger l'image depuis
-le fichier et la convertir en tableau. Toutes les autres opérations sont manuelles.
+LECTURE PNM :
+
+Les fichiers PGM/PPM sont mappés en mémoire (mmap, ACCESS_COPY) :
+l'en-tête est analysé directement dans les octets mappés et, pour un
+P5, le raster est adopté tel quel par l'Image (stockage plat) sans
+copie — les pages ne sont copiées que si l'image est modifiée
+(copy-on-write). Les variantes ASCII (P2/P3) passent par un tokenizer
+en bloc au lieu d'une lecture octet par octet.
+
+IMPORTANT: numpy/OpenCV sont utilisés UNIQUEMENT pour les formats non
+PNM (chargement via cv2). Toutes les autres opérations sont manuelles.
 
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
 
-import numpy as np
+import glob
+import mmap
+import struct
+from array import array
 from pathlib import Path
-from typing import BinaryIO, List
+from typing import BinaryIO, List, Tuple
 import sys
 import os
 
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
-from core.image import Image, ColorImage
+from core.image import Image, ColorImage, ImageVolume, LabelImage
+
+try:
+    import numpy as np
+    NUMPY_AVAILABLE = True
+except ImportError:
+    np = None
+    NUMPY_AVAILABLE = False
 
 try:
     import cv2
@@ -26,6 +45,34 @@ try:
 except ImportError:
     OPENCV_AVAILABLE = False
 
+# Octets blancs au sens PNM
+_PNM_WHITESPACE = (0x20, 0x09, 0x0A, 0x0D, 0x0B, 0x0C)
+
+# Tables de binarisation par seuil (256 entrées : octet -> 0 ou 255),
+# construites à la demande et réutilisées
+_THRESHOLD_LUTS = {}
+
+
+def _threshold_lut(threshold: int) -> bytes:
+    """
+    Retourne la table de binarisation d'un seuil (octet -> 0 ou 255).
+
+    Appliquée avec bytes.translate(), elle binarise un raster entier en
+    un seul passage C : c'est le cœur du chemin décodage + binarisation
+    fusionnés des lecteurs.
+
+    Args:
+        threshold: Seuil (pixels >= threshold -> 255)
+
+    Returns:
+        Table de 256 octets
+    """
+    lut = _THRESHOLD_LUTS.get(threshold)
+    if lut is None:
+        lut = bytes(255 if value >= threshold else 0 for value in range(256))
+        _THRESHOLD_LUTS[threshold] = lut
+    return lut
+
 
 class ImageIO:
     """
@@ -38,6 +85,13 @@ class ImageIO:
     Toutes les autres opérations sont implémentées manuellement.
     """
 
+    # Format binaire .lab : en-tête fixe de 20 octets
+    # magic (4) + largeur (4) + hauteur (4) + nb composantes (4, -1 si
+    # inconnu) + taille d'un label (1) + bourrage (3, raster aligné)
+    LAB_MAGIC = b'LAB1'
+    LAB_HEADER_SIZE = 20
+    LAB_ITEM_SIZE = 4
+
     @staticmethod
     def _skip_whitespace_and_comments(file: BinaryIO) -> None:
         """
@@ -83,17 +137,110 @@ class ImageIO:
         return number
 
     @staticmethod
-    def _numpy_array_to_list2d(arr, height: int, width: int) -> List[List[int]]:
+    def _mmap_file(filename: str) -> mmap.mmap:
         """
-        Convertit un array numpy 1D en liste Python 2D.
+        Mappe un fichier en mémoire en mode copy-on-write.
+
+        Le tampon retourné est adressable comme des octets et reste
+        modifiable (ACCESS_COPY : les écritures restent privées au
+        processus), ce qui permet à Image d'adopter le raster sans
+        copie puis de le binariser en place.
+
+        Args:
+            filename: Chemin du fichier
+
+        Returns:
+            Objet mmap sur le contenu du fichier
         """
-        result = []
-        for x in range(height):
-            row = []
-            for y in range(width):
-                row.append(int(arr[x * width + y]))
-            result.append(row)
-        return result
+        with open(filename, 'rb') as file:
+            return mmap.mmap(file.fileno(), 0, access=mmap.ACCESS_COPY)
+
+    @staticmethod
+    def _parse_pnm_number(data, pos: int) -> Tuple[int, int]:
+        """
+        Lit un entier dans un tampon PNM mappé, en sautant les espaces
+        et les commentaires.
+
+        Args:
+            data: Tampon d'octets (mmap ou bytes)
+            pos: Position de départ
+
+        Returns:
+            Tuple (valeur, position après le nombre)
+        """
+        n = len(data)
+
+        while pos < n:
+            c = data[pos]
+            if c == 0x23:  # '#': commentaire jusqu'en fin de ligne
+                while pos < n and data[pos] != 0x0A:
+                    pos += 1
+            elif c in _PNM_WHITESPACE:
+                pos += 1
+            else:
+                break
+
+        number = 0
+        has_digit = False
+        while pos < n and 0x30 <= data[pos] <= 0x39:
+            number = number * 10 + (data[pos] - 0x30)
+            has_digit = True
+            pos += 1
+
+        if not has_digit:
+            raise RuntimeError("Erreur de lecture: nombre attendu")
+
+        return number, pos
+
+    @staticmethod
+    def _parse_pnm_header(data) -> Tuple[str, int, int, int, int]:
+        """
+        Analyse l'en-tête d'un fichier PNM mappé.
+
+        Args:
+            data: Tampon d'octets (mmap ou bytes)
+
+        Returns:
+            Tuple (magic, width, height, max_value, offset) où offset
+            est la position du premier octet du raster
+        """
+        if len(data) < 2:
+            raise RuntimeError("Fichier PNM tronque")
+
+        magic = bytes(data[0:2]).decode('ascii', errors='replace')
+
+        width, pos = ImageIO._parse_pnm_number(data, 2)
+        height, pos = ImageIO._parse_pnm_number(data, pos)
+        max_value, pos = ImageIO._parse_pnm_number(data, pos)
+
+        if width <= 0 or height <= 0:
+            raise RuntimeError("Dimensions invalides")
+
+        # Un unique caractère blanc sépare l'en-tête du raster binaire
+        pos += 1
+
+        return magic, width, height, max_value, pos
+
+    @staticmethod
+    def _tokenize_pnm_ascii(data, offset: int) -> List[bytes]:
+        """
+        Découpe en bloc le raster d'un PNM ASCII (P2/P3).
+
+        Remplace la lecture octet par octet : une seule passe split()
+        sur le tampon, après suppression éventuelle des commentaires.
+
+        Args:
+            data: Tampon d'octets (mmap ou bytes)
+            offset: Position du début du raster (après max_value)
+
+        Returns:
+            Liste des valeurs sous forme de tokens bytes
+        """
+        raw = bytes(data[offset - 1:])
+        if b'#' in raw:
+            raw = b'\n'.join(line.split(b'#', 1)[0]
+                             for line in raw.split(b'\n'))
+        return raw.split()
 
     @staticmethod
     def _cv2_array_to_list2d(arr) -> List[List[int]]:
@@ -120,7 +267,7 @@ class ImageIO:
         return result
 
     @staticmethod
-    def read_with_opencv(filename: str) -> Image:
+    def read_with_opencv(filename: str, threshold: int = None) -> Image:
         """
         Lit une image avec OpenCV (JPEG, PNG, BMP, TIFF, etc.).
 
@@ -129,6 +276,9 @@ class ImageIO:
 
         Args:
             filename: Chemin du fichier
+            threshold: Si renseigné, binarise l'array numpy avant la
+                       conversion (cv2.threshold, vectorisé) : seule la
+                       version binaire traverse le pont numpy -> Python
 
         Returns:
             Image en niveaux de gris
@@ -145,6 +295,13 @@ class ImageIO:
         if cv_image is None:
             raise RuntimeError(f"Impossible de lire l'image: {filename}")
 
+        if threshold is not None:
+            # THRESH_BINARY met à 255 les pixels STRICTEMENT supérieurs
+            # au seuil passé : threshold - 1 reproduit la règle
+            # historique "pixels >= threshold -> 255" de binarize()
+            _, cv_image = cv2.threshold(cv_image, threshold - 1, 255,
+                                        cv2.THRESH_BINARY)
+
         height, width = cv_image.shape
         image = Image(width, height, 255)
         image.data = ImageIO._cv2_array_to_list2d(cv_image)
@@ -152,159 +309,357 @@ class ImageIO:
         return image
 
     @staticmethod
-    def read_pgm(filename: str) -> Image:
+    def read_pgm(filename: str, threshold: int = None) -> Image:
         """
-        Lit une image PGM depuis un fichier.
+        Lit une image PGM depuis un fichier mappé en mémoire.
         Supporte les formats P2 (ASCII) et P5 (binaire).
+
+        Pour un P5, le raster mappé est adopté sans copie par l'Image
+        (les pages sont copiées paresseusement à la première écriture).
+
+        Args:
+            filename: Chemin du fichier
+            threshold: Si renseigné, binarise PENDANT le décodage (table
+                       de 256 entrées appliquée au raster en un passage
+                       C via translate) : l'intermédiaire en niveaux de
+                       gris n'est jamais matérialisé séparément
         """
-        with open(filename, 'rb') as file:
+        data = ImageIO._mmap_file(filename)
+        magic, width, height, max_value, offset = ImageIO._parse_pnm_header(data)
+
+        if magic not in ('P2', 'P5'):
+            raise RuntimeError(f"Format non supporte (uniquement P2 et P5): {magic}")
+
+        size = width * height
+        image = Image(0, 0, max_value)
+
+        if magic == 'P5':
+            if len(data) - offset < size:
+                raise RuntimeError("Erreur de lecture des donnees binaires")
+            if threshold is None:
+                image.adopt_buffer(memoryview(data)[offset:offset + size],
+                                   width, height)
+            else:
+                raster = data[offset:offset + size]
+                image.adopt_buffer(
+                    bytearray(raster.translate(_threshold_lut(threshold))),
+                    width, height)
+        else:
+            tokens = ImageIO._tokenize_pnm_ascii(data, offset)
+            if len(tokens) < size:
+                raise RuntimeError("Erreur de lecture: nombre attendu")
+            values = bytearray(size)
+            if threshold is None:
+                for i in range(size):
+                    value = int(tokens[i])
+                    if value < 0 or value > max_value:
+                        raise RuntimeError("Valeur de pixel invalide")
+                    values[i] = value
+            else:
+                for i in range(size):
+                    value = int(tokens[i])
+                    if value < 0 or value > max_value:
+                        raise RuntimeError("Valeur de pixel invalide")
+                    values[i] = 255 if value >= threshold else 0
+            image.adopt_buffer(values, width, height)
+
+        return image
+
+    @staticmethod
+    def read_pgm_rows(filename: str):
+        """
+        Lit un PGM binaire (P5) ligne par ligne, sans charger le raster.
+
+        Permet de traiter des images plus grandes que la RAM : seule la
+        ligne courante est en mémoire (O(width)).
+
+        Args:
+            filename: Chemin du fichier PGM (P5 uniquement)
+
+        Returns:
+            Tuple (width, height, max_value, rows) où rows est un
+            générateur produisant chaque ligne sous forme de bytes
+
+        Raises:
+            RuntimeError: si le fichier n'est pas un PGM binaire valide
+        """
+        file = open(filename, 'rb')
+        try:
             magic = b''
             c = file.read(1)
             while c and not c.isspace():
                 magic += c
                 c = file.read(1)
-            magic = magic.decode('ascii')
 
-            if magic not in ('P2', 'P5'):
-                raise RuntimeError(f"Format non supporte (uniquement P2 et P5): {magic}")
-
-            is_binary = (magic == 'P5')
+            if magic.decode('ascii') != 'P5':
+                raise RuntimeError(
+                    "La lecture en flux requiert un PGM binaire (P5)")
 
             width = ImageIO._read_number(file)
             height = ImageIO._read_number(file)
             max_value = ImageIO._read_number(file)
+            file.read(1)
 
             if width <= 0 or height <= 0:
                 raise RuntimeError("Dimensions invalides")
+        except Exception:
+            file.close()
+            raise
 
-            image = Image(width, height, max_value)
+        def rows():
+            try:
+                for _ in range(height):
+                    row = file.read(width)
+                    if len(row) != width:
+                        raise RuntimeError("Erreur de lecture des donnees binaires")
+                    yield row
+            finally:
+                file.close()
 
-            if is_binary:
-                file.read(1)
-                raw_data = file.read(width * height)
-                if len(raw_data) != width * height:
-                    raise RuntimeError("Erreur de lecture des donnees binaires")
+        return width, height, max_value, rows()
 
-                numpy_arr = np.frombuffer(raw_data, dtype=np.uint8)
-                image.data = ImageIO._numpy_array_to_list2d(numpy_arr, height, width)
-            else:
-                data = [[0 for _ in range(width)] for _ in range(height)]
-                for x in range(height):
-                    for y in range(width):
-                        value = ImageIO._read_number(file)
-                        if value < 0 or value > max_value:
-                            raise RuntimeError("Valeur de pixel invalide")
-                        data[x][y] = value
-                image.data = data
+    @staticmethod
+    def write_pgm_header(file: BinaryIO, width: int, height: int,
+                         max_value: int = 255) -> None:
+        """
+        Écrit l'en-tête d'un PGM binaire (P5) dans un flux ouvert.
 
-        return image
+        Utilisé par le mode streaming : les lignes de pixels peuvent
+        ensuite être écrites directement avec file.write().
+
+        Args:
+            file: Flux binaire ouvert en écriture
+            width: Largeur de l'image
+            height: Hauteur de l'image
+            max_value: Valeur maximale des pixels
+        """
+        header = f"P5\n# Created by Labellisation Project\n{width} {height}\n{max_value}\n"
+        file.write(header.encode('ascii'))
 
     @staticmethod
-    def write_pgm(filename: str, image: Image, binary: bool = True) -> None:
+    def write_pgm(filename: str, image: Image, binary: bool = True,
+                  buffer_size: int = 1 << 20) -> None:
         """
         Écrit une image au format PGM.
+
+        Le raster est assemblé en mémoire puis écrit en gros blocs
+        (une écriture pour un P5, une par groupe de lignes pour un P2)
+        au lieu d'un appel système par pixel.
+
+        Args:
+            filename: Chemin du fichier
+            image: Image à sauvegarder
+            binary: True pour P5 (binaire), False pour P2 (ASCII)
+            buffer_size: Taille du tampon d'écriture du fichier
         """
-        with open(filename, 'wb') as file:
+        with open(filename, 'wb', buffering=buffer_size) as file:
             if binary:
                 header = f"P5\n# Created by Labellisation Project\n{image.width} {image.height}\n{image.max_value}\n"
                 file.write(header.encode('ascii'))
-                for x in range(image.height):
-                    for y in range(image.width):
-                        file.write(bytes([image.at(x, y)]))
+                file.write(image.buffer)
             else:
                 header = f"P2\n# Created by Labellisation Project\n{image.width} {image.height}\n{image.max_value}\n"
                 file.write(header.encode('ascii'))
-                count = 0
-                for x in range(image.height):
-                    for y in range(image.width):
-                        file.write(f"{image.at(x, y)} ".encode('ascii'))
-                        count += 1
-                        if count % 16 == 0:
-                            file.write(b"\n")
-                if count % 16 != 0:
-                    file.write(b"\n")
+                buf = image.buffer
+                for i in range(0, image.size, 16):
+                    line = ' '.join(str(v) for v in buf[i:i + 16])
+                    file.write((line + ' \n').encode('ascii'))
 
     @staticmethod
-    def read_ppm(filename: str) -> Image:
-        """
-        Lit une image PPM (couleur) et la convertit en niveaux de gris.
+    def read_ppm(filename: str, threshold: int = None) -> Image:
         """
-        with open(filename, 'rb') as file:
-            magic = b''
-            c = file.read(1)
-            while c and not c.isspace():
-                magic += c
-                c = file.read(1)
-            magic = magic.decode('ascii')
-
-            if magic not in ('P3', 'P6'):
-                raise RuntimeError(f"Format non supporte (uniquement P3 et P6): {magic}")
-
-            is_binary = (magic == 'P6')
-
-            width = ImageIO._read_number(file)
-            height = ImageIO._read_number(file)
-            max_value = ImageIO._read_number(file)
-
-            if width <= 0 or height <= 0:
-                raise RuntimeError("Dimensions invalides")
+        Lit une image PPM (couleur) mappée en mémoire et la convertit
+        en niveaux de gris.
 
-            image = Image(width, height, max_value)
-            data = [[0 for _ in range(width)] for _ in range(height)]
-
-            if is_binary:
-                file.read(1)
-                raw_data = file.read(width * height * 3)
-                if len(raw_data) != width * height * 3:
-                    raise RuntimeError("Erreur de lecture des donnees binaires")
-
-                numpy_arr = np.frombuffer(raw_data, dtype=np.uint8)
-
-                for x in range(height):
-                    for y in range(width):
-                        idx = (x * width + y) * 3
-                        r = int(numpy_arr[idx])
-                        g = int(numpy_arr[idx + 1])
-                        b = int(numpy_arr[idx + 2])
-                        gray = (299 * r + 587 * g + 114 * b) // 1000
-                        data[x][y] = gray
+        Args:
+            filename: Chemin du fichier
+            threshold: Si renseigné, binarise PENDANT la conversion en
+                       niveaux de gris : la comparaison se fait sur la
+                       somme pondérée entière (sans division par 1000)
+                       et le gris intermédiaire n'est jamais matérialisé
+        """
+        data = ImageIO._mmap_file(filename)
+        magic, width, height, max_value, offset = ImageIO._parse_pnm_header(data)
+
+        if magic not in ('P3', 'P6'):
+            raise RuntimeError(f"Format non supporte (uniquement P3 et P6): {magic}")
+
+        size = width * height
+        gray = bytearray(size)
+
+        # Seuil rapporté à la somme pondérée (299R + 587G + 114B),
+        # pour comparer sans diviser par 1000 à chaque pixel
+        scaled_threshold = threshold * 1000 if threshold is not None else None
+
+        if magic == 'P6':
+            if len(data) - offset < size * 3:
+                raise RuntimeError("Erreur de lecture des donnees binaires")
+            rgb = memoryview(data)[offset:offset + size * 3]
+            idx = 0
+            if threshold is None:
+                for i in range(size):
+                    gray[i] = (299 * rgb[idx] + 587 * rgb[idx + 1]
+                               + 114 * rgb[idx + 2]) // 1000
+                    idx += 3
             else:
-                for x in range(height):
-                    for y in range(width):
-                        r = ImageIO._read_number(file)
-                        g = ImageIO._read_number(file)
-                        b = ImageIO._read_number(file)
-                        gray = (299 * r + 587 * g + 114 * b) // 1000
-                        data[x][y] = gray
+                for i in range(size):
+                    weighted = (299 * rgb[idx] + 587 * rgb[idx + 1]
+                                + 114 * rgb[idx + 2])
+                    if weighted >= scaled_threshold:
+                        gray[i] = 255
+                    idx += 3
+        else:
+            tokens = ImageIO._tokenize_pnm_ascii(data, offset)
+            if len(tokens) < size * 3:
+                raise RuntimeError("Erreur de lecture: nombre attendu")
+            idx = 0
+            if threshold is None:
+                for i in range(size):
+                    r = int(tokens[idx])
+                    g = int(tokens[idx + 1])
+                    b = int(tokens[idx + 2])
+                    gray[i] = (299 * r + 587 * g + 114 * b) // 1000
+                    idx += 3
+            else:
+                for i in range(size):
+                    weighted = (299 * int(tokens[idx])
+                                + 587 * int(tokens[idx + 1])
+                                + 114 * int(tokens[idx + 2]))
+                    if weighted >= scaled_threshold:
+                        gray[i] = 255
+                    idx += 3
 
-            image.data = data
+        image = Image(0, 0, max_value)
+        image.adopt_buffer(gray, width, height)
 
         return image
 
     @staticmethod
-    def write_ppm(filename: str, image: Image, binary: bool = True) -> None:
+    def write_ppm(filename: str, image: Image, binary: bool = True,
+                  buffer_size: int = 1 << 20) -> None:
         """
-        Écrit une image couleur au format PPM.
+        Écrit une image en niveaux de gris au format PPM (R = G = B).
+
+        Chaque ligne est assemblée dans un bytearray et écrite d'un
+        bloc au lieu d'un appel système par pixel.
+
+        Args:
+            filename: Chemin du fichier
+            image: Image à sauvegarder
+            binary: True pour P6 (binaire), False pour P3 (ASCII)
+            buffer_size: Taille du tampon d'écriture du fichier
         """
-        with open(filename, 'wb') as file:
+        width = image.width
+        with open(filename, 'wb', buffering=buffer_size) as file:
             if binary:
                 header = f"P6\n# Created by Labellisation Project\n{image.width} {image.height}\n{image.max_value}\n"
                 file.write(header.encode('ascii'))
+                row_bytes = bytearray(width * 3)
                 for x in range(image.height):
-                    for y in range(image.width):
-                        value = image.at(x, y)
-                        file.write(bytes([value, value, value]))
+                    row = image.row(x)
+                    idx = 0
+                    for y in range(width):
+                        value = row[y]
+                        row_bytes[idx] = value
+                        row_bytes[idx + 1] = value
+                        row_bytes[idx + 2] = value
+                        idx += 3
+                    file.write(row_bytes)
             else:
                 header = f"P3\n# Created by Labellisation Project\n{image.width} {image.height}\n{image.max_value}\n"
                 file.write(header.encode('ascii'))
-                count = 0
-                for x in range(image.height):
-                    for y in range(image.width):
-                        value = image.at(x, y)
-                        file.write(f"{value} {value} {value} ".encode('ascii'))
-                        count += 1
-                        if count % 5 == 0:
-                            file.write(b"\n")
+                buf = image.buffer
+                for i in range(0, image.size, 5):
+                    line = ''.join(f"{v} {v} {v} " for v in buf[i:i + 5])
+                    if i + 5 <= image.size:
+                        line += '\n'
+                    file.write(line.encode('ascii'))
+
+    @staticmethod
+    def write_lab(filename: str, labels: 'LabelImage',
+                  buffer_size: int = 1 << 20) -> None:
+        """
+        Écrit une image de labels au format binaire .lab.
+
+        Contrairement à to_visualization() (labels écrasés sur 8 bits,
+        perte au-delà de 254 composantes), le format .lab conserve les
+        valeurs réelles : en-tête de 20 octets (magic 'LAB1', largeur,
+        hauteur, nombre de composantes, taille d'un label) puis le
+        raster brut en entiers 32 bits little-endian, écrit d'un bloc.
+
+        Args:
+            filename: Chemin du fichier de sortie
+            labels: LabelImage à sauvegarder
+            buffer_size: Taille du tampon d'écriture du fichier
+        """
+        num_components = labels.num_components
+        header = struct.pack(
+            '<4sIIiB3x', ImageIO.LAB_MAGIC, labels.width, labels.height,
+            num_components if num_components is not None else -1,
+            ImageIO.LAB_ITEM_SIZE)
+
+        with open(filename, 'wb', buffering=buffer_size) as file:
+            file.write(header)
+            buf = labels.buffer
+            if sys.byteorder == 'little':
+                # array('i') natif = déjà little-endian : écriture directe
+                file.write(buf)
+            else:
+                swapped = array('i', buf)
+                swapped.byteswap()
+                file.write(swapped)
+
+    @staticmethod
+    def read_lab(filename: str) -> 'LabelImage':
+        """
+        Recharge une image de labels depuis un fichier .lab mappé.
+
+        Le raster mappé (ACCESS_COPY) est adopté par la LabelImage sans
+        copie, via une memoryview castée en entiers 32 bits : le
+        rechargement coûte l'analyse de l'en-tête, pas une relecture
+        pixel par pixel ni une relabellisation. Le nombre de composantes
+        stocké réalimente directement le cache de count_labels().
+
+        Args:
+            filename: Chemin du fichier .lab
+
+        Returns:
+            LabelImage rechargée
+
+        Raises:
+            RuntimeError: si le fichier n'est pas un .lab valide
+        """
+        data = ImageIO._mmap_file(filename)
+
+        if len(data) < ImageIO.LAB_HEADER_SIZE \
+                or data[0:4] != ImageIO.LAB_MAGIC:
+            raise RuntimeError(f"Format .lab invalide: {filename}")
+
+        width, height, num_components, item_size = struct.unpack_from(
+            '<IIiB', data, 4)
+        if item_size != ImageIO.LAB_ITEM_SIZE:
+            raise RuntimeError(
+                f"Taille de label non supportee: {item_size} octets")
+
+        size = width * height
+        offset = ImageIO.LAB_HEADER_SIZE
+        if len(data) - offset < size * item_size:
+            raise RuntimeError("Erreur de lecture des donnees binaires")
+
+        raster = memoryview(data)[offset:offset + size * item_size]
+        if sys.byteorder == 'little':
+            buf = raster.cast('i')
+        else:
+            buf = array('i')
+            buf.frombytes(raster)
+            buf.byteswap()
+
+        labels = LabelImage()
+        labels.adopt_buffer(buf, width, height)
+        if num_components >= 0:
+            labels.num_components = num_components
+
+        return labels
 
     @staticmethod
     def write_with_opencv(filename: str, image: Image) -> None:
@@ -330,7 +685,7 @@ class ImageIO:
         cv2.imwrite(filename, arr)
 
     @staticmethod
-    def read_image(filename: str) -> Image:
+    def read_image(filename: str, threshold: int = None) -> Image:
         """
         Lit une image en détectant automatiquement le format.
 
@@ -340,6 +695,9 @@ class ImageIO:
 
         Args:
             filename: Chemin du fichier
+            threshold: Si renseigné, binarise pendant le décodage (voir
+                       read_pgm/read_ppm/read_with_opencv) : un appel
+                       séparé à binarize() devient inutile
 
         Returns:
             Image chargée
@@ -347,9 +705,9 @@ class ImageIO:
         ext = Path(filename).suffix.lower()
 
         if ext == '.pgm':
-            return ImageIO.read_pgm(filename)
+            return ImageIO.read_pgm(filename, threshold)
         elif ext == '.ppm':
-            return ImageIO.read_ppm(filename)
+            return ImageIO.read_ppm(filename, threshold)
 
         opencv_formats = {
             '.jpg', '.jpeg', '.png', '.bmp', '.tiff', '.tif',
@@ -357,26 +715,58 @@ class ImageIO:
         }
 
         if ext in opencv_formats:
-            return ImageIO.read_with_opencv(filename)
+            return ImageIO.read_with_opencv(filename, threshold)
 
         try:
             with open(filename, 'rb') as f:
                 magic = f.read(2).decode('ascii', errors='ignore')
             if magic in ('P2', 'P5'):
-                return ImageIO.read_pgm(filename)
+                return ImageIO.read_pgm(filename, threshold)
             elif magic in ('P3', 'P6'):
-                return ImageIO.read_ppm(filename)
+                return ImageIO.read_ppm(filename, threshold)
         except:
             pass
 
         if OPENCV_AVAILABLE:
             try:
-                return ImageIO.read_with_opencv(filename)
+                return ImageIO.read_with_opencv(filename, threshold)
             except:
                 pass
 
         raise RuntimeError(f"Format de fichier non reconnu: {filename}")
 
+    @staticmethod
+    def read_volume(path: str, threshold: int = None) -> ImageVolume:
+        """
+        Lit une pile de coupes comme un volume (core/image.py).
+
+        Les coupes sont ordonnées par tri lexicographique des noms de
+        fichiers (z croissant) ; toutes doivent avoir les mêmes
+        dimensions.
+
+        Args:
+            path: Répertoire contenant les coupes, ou motif glob
+                  (ex. "scans/coupe_*.pgm")
+            threshold: Si renseigné, binarise chaque coupe pendant le
+                       décodage (voir read_image)
+
+        Returns:
+            ImageVolume des coupes chargées
+        """
+        if os.path.isdir(path):
+            files = sorted(
+                os.path.join(path, name) for name in os.listdir(path)
+                if os.path.isfile(os.path.join(path, name))
+                and not name.startswith('.'))
+        else:
+            files = sorted(glob.glob(path))
+
+        if not files:
+            raise RuntimeError(f"Aucune coupe trouvee: {path}")
+
+        return ImageVolume(
+            [ImageIO.read_image(name, threshold) for name in files])
+
     @staticmethod
     def write_image(filename: str, image: Image) -> None:
         """
@@ -416,34 +806,36 @@ class ImageIO:
             ImageIO.write_color_ppm(filename, color_image)
 
     @staticmethod
-    def write_color_ppm(filename: str, color_image: ColorImage, binary: bool = True) -> None:
+    def write_color_ppm(filename: str, color_image: ColorImage,
+                        binary: bool = True, buffer_size: int = 1 << 20) -> None:
         """
         Écrit une image couleur au format PPM.
 
+        Le raster packé est permuté BGR -> RGB en trois affectations de
+        tranches (to_rgb_bytes) puis écrit en un seul bloc : aucune
+        boucle par pixel en mode binaire.
+
         Args:
             filename: Chemin du fichier
-            color_image: Image couleur RGB
+            color_image: Image couleur (tampon packé BGR)
             binary: True pour P6 (binaire), False pour P3 (ASCII)
+            buffer_size: Taille du tampon d'écriture du fichier
         """
-        with open(filename, 'wb') as file:
+        with open(filename, 'wb', buffering=buffer_size) as file:
             if binary:
                 header = f"P6\n# Color visualization - Labellisation Project\n{color_image.width} {color_image.height}\n255\n"
                 file.write(header.encode('ascii'))
-                for x in range(color_image.height):
-                    for y in range(color_image.width):
-                        r, g, b = color_image.at(x, y)
-                        file.write(bytes([r, g, b]))
+                file.write(color_image.to_rgb_bytes())
             else:
                 header = f"P3\n# Color visualization - Labellisation Project\n{color_image.width} {color_image.height}\n255\n"
                 file.write(header.encode('ascii'))
-                count = 0
-                for x in range(color_image.height):
-                    for y in range(color_image.width):
-                        r, g, b = color_image.at(x, y)
-                        file.write(f"{r} {g} {b} ".encode('ascii'))
-                        count += 1
-                        if count % 5 == 0:
-                            file.write(b"\n")
+                rgb = color_image.to_rgb_bytes()
+                parts = []
+                for i in range(0, len(rgb), 3):
+                    parts.append(f"{rgb[i]} {rgb[i + 1]} {rgb[i + 2]} ")
+                    if (i // 3) % 5 == 4:
+                        parts.append("\n")
+                file.write(''.join(parts).encode('ascii'))
 
     @staticmethod
     def write_color_with_opencv(filename: str, color_image: ColorImage) -> None:
@@ -459,13 +851,8 @@ class ImageIO:
                 "OpenCV n'est pas installe. Utilisez le format PPM ou installez OpenCV."
             )
 
-        height = color_image.height
-        width = color_image.width
-
-        arr = np.zeros((height, width, 3), dtype=np.uint8)
-        for x in range(height):
-            for y in range(width):
-                r, g, b = color_image.at(x, y)
-                arr[x, y] = [b, g, r]
-
+        # Le tampon packé de ColorImage est déjà en ordre BGR : numpy
+        # l'enveloppe sans copie et cv2 l'encode tel quel
+        arr = np.frombuffer(color_image.buffer, dtype=np.uint8).reshape(
+            color_image.height, color_image.width, 3)
         cv2.imwrite(filename, arr)
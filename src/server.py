@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Mode serveur de labellisation (processus chaud)
+
+Démarre une fois, pré-importe les dépendances lourdes (cv2, numpy via
+ImageIO), puis traite des requêtes de labellisation sans repayer les
+~700 ms de démarrage de processus à chaque image.
+
+PROTOCOLE (une ligne par requête) :
+
+  <input> <output> <algorithm> <connectivity>
+
+Réponse (une ligne par requête) :
+
+  OK <temps_ms> <nb_composantes>
+  ERR <message>
+
+La ligne "QUIT" ferme la connexion (et le serveur en mode stdin).
+Les algorithmes sont ceux de main.py (two_pass | union_find | kruskal |
+prim | rle | parallel:<base>).
+
+Usage :
+  python server.py                     # requêtes sur stdin, réponses sur stdout
+  python server.py --socket /tmp/labellisation.sock   # socket Unix
+
+Exemple (stdin) :
+  echo "scan.pgm out.pgm rle 8" | python server.py
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import sys
+import os
+import socket
+
+# Ajouter le répertoire courant au path pour les imports
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from readers.image_io import ImageIO
+from utils.utils import Timer
+from main import label_image, is_valid_algorithm
+
+
+def handle_request(line: str) -> str:
+    """
+    Traite une requête de labellisation.
+
+    Args:
+        line: Requête "<input> <output> <algorithm> <connectivity>"
+
+    Returns:
+        Ligne de réponse ("OK <temps_ms> <nb_composantes>" ou "ERR ...")
+    """
+    parts = line.split()
+    if len(parts) != 4:
+        return "ERR format attendu: <input> <output> <algorithm> <connectivity>"
+
+    input_path, output_path, algorithm, connectivity_str = parts
+
+    if not is_valid_algorithm(algorithm):
+        return f"ERR algorithme invalide: {algorithm}"
+
+    try:
+        connectivity = int(connectivity_str)
+    except ValueError:
+        connectivity = 0
+    if connectivity not in (4, 8):
+        return "ERR la connectivite doit etre 4 ou 8"
+
+    timer = Timer()
+    timer.start()
+
+    try:
+        input_image = ImageIO.read_image(input_path, threshold=128)
+        labels = label_image(algorithm, input_image, connectivity)
+        ImageIO.write_image(output_path, labels.to_visualization())
+        num_components = labels.count_labels()
+    except Exception as e:
+        return f"ERR {e}"
+
+    return f"OK {timer.stop():.2f} {num_components}"
+
+
+def serve_stdin() -> int:
+    """
+    Boucle de service sur stdin/stdout (une requête par ligne).
+
+    Returns:
+        Code de retour (0 = succès)
+    """
+    for line in sys.stdin:
+        line = line.strip()
+        if not line:
+            continue
+        if line == "QUIT":
+            break
+        print(handle_request(line), flush=True)
+    return 0
+
+
+def serve_socket(socket_path: str) -> int:
+    """
+    Boucle de service sur une socket Unix.
+
+    Les connexions sont traitées séquentiellement ; chaque client peut
+    envoyer plusieurs requêtes sur la même connexion.
+
+    Args:
+        socket_path: Chemin de la socket Unix
+
+    Returns:
+        Code de retour (0 = succès)
+    """
+    if os.path.exists(socket_path):
+        os.unlink(socket_path)
+
+    server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    server.bind(socket_path)
+    server.listen(1)
+    print(f"Serveur en ecoute sur {socket_path}", flush=True)
+
+    try:
+        while True:
+            connection, _ = server.accept()
+            with connection:
+                stream = connection.makefile('rw', encoding='utf-8')
+                for line in stream:
+                    line = line.strip()
+                    if not line:
+                        continue
+                    if line == "QUIT":
+                        break
+                    stream.write(handle_request(line) + "\n")
+                    stream.flush()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.close()
+        if os.path.exists(socket_path):
+            os.unlink(socket_path)
+
+    return 0
+
+
+def main():
+    """Fonction principale."""
+    if len(sys.argv) == 1:
+        return serve_stdin()
+    if len(sys.argv) == 3 and sys.argv[1] == "--socket":
+        return serve_socket(sys.argv[2])
+
+    print(f"Usage: python {sys.argv[0]} [--socket <chemin>]", file=sys.stderr)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,189 @@
+"""
+Module utils/result_cache.py - Cache de résultats adressé par contenu
+
+L'ingestion voit passer les mêmes octets des milliers de fois (un même
+formulaire scanné revient en masse) : relabelliser des rasters
+identiques est du calcul pur et simple jeté. Ce cache persistant
+mémorise les résultats de labellisation :
+
+- clé : empreinte SHA-256 du raster binarisé + dimensions + algorithme
+  + connectivité (tout ce qui détermine le résultat, rien d'autre)
+- valeur : un fichier .lab (voir readers/image_io.py), rechargé par
+  mmap sans copie — un hit coûte une empreinte et une ouverture de
+  fichier, pas une labellisation
+
+ÉVICTION :
+
+Le répertoire est borné en octets ; au-delà du plafond, les entrées
+les moins récemment utilisées sont supprimées (LRU approché par date
+d'accès : chaque hit rafraîchit le mtime de son fichier).
+
+Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
+"""
+
+import hashlib
+import os
+import sys
+import tempfile
+from typing import Optional
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from core.image import Image, LabelImage
+from readers.image_io import ImageIO
+
+
+# Plafond par défaut du répertoire cache (octets)
+DEFAULT_MAX_BYTES = 256 * 1024 * 1024
+
+# Répertoire par défaut (respecte XDG_CACHE_HOME si défini)
+DEFAULT_CACHE_DIR = os.path.join(
+    os.environ.get('XDG_CACHE_HOME', os.path.expanduser('~/.cache')),
+    'labellisation')
+
+
+class ResultCache:
+    """
+    Cache persistant de résultats de labellisation, adressé par contenu.
+
+    Utilisation :
+        cache = ResultCache()
+        key = cache.key(image, 'two_pass', 4)
+        labels = cache.get(key)
+        if labels is None:
+            labels = TwoPass.label(image, 4)
+            cache.put(key, labels)
+    """
+
+    def __init__(self, cache_dir: str = DEFAULT_CACHE_DIR,
+                 max_bytes: int = DEFAULT_MAX_BYTES):
+        """
+        Constructeur.
+
+        Args:
+            cache_dir: Répertoire des fichiers .lab mis en cache
+            max_bytes: Plafond du répertoire, 0 = pas de limite
+        """
+        self._cache_dir = cache_dir
+        self._max_bytes = max_bytes
+        os.makedirs(cache_dir, exist_ok=True)
+
+    @staticmethod
+    def key(image: Image, algorithm: str, connectivity: int) -> str:
+        """
+        Calcule la clé de cache d'une labellisation.
+
+        L'empreinte couvre le raster binarisé, les dimensions,
+        l'algorithme et la connectivité : deux images aux octets
+        identiques traitées avec les mêmes paramètres partagent la
+        même entrée, quel que soit leur nom de fichier.
+
+        Args:
+            image: Image binarisée
+            algorithm: Nom de l'algorithme
+            connectivity: Connectivité (4 ou 8)
+
+        Returns:
+            Clé hexadécimale
+        """
+        digest = hashlib.sha256()
+        digest.update(f"{image.width}x{image.height}"
+                      f"|{algorithm}|{connectivity}".encode('ascii'))
+        digest.update(image.buffer)
+        return digest.hexdigest()
+
+    def _path(self, key: str) -> str:
+        """Retourne le chemin du fichier .lab d'une clé."""
+        return os.path.join(self._cache_dir, key + '.lab')
+
+    def get(self, key: str) -> Optional[LabelImage]:
+        """
+        Recherche un résultat en cache.
+
+        Un hit rafraîchit la date du fichier (position LRU) et recharge
+        les labels par mmap sans copie.
+
+        Args:
+            key: Clé retournée par key()
+
+        Returns:
+            LabelImage en cache, ou None
+        """
+        path = self._path(key)
+        try:
+            labels = ImageIO.read_lab(path)
+        except (OSError, RuntimeError):
+            return None
+
+        try:
+            os.utime(path)
+        except OSError:
+            pass
+
+        return labels
+
+    def put(self, key: str, labels: LabelImage) -> None:
+        """
+        Enregistre un résultat dans le cache.
+
+        L'écriture passe par un fichier temporaire renommé ensuite :
+        une entrée est soit absente, soit complète, même si deux
+        processus labellisent la même image en parallèle.
+
+        Args:
+            key: Clé retournée par key()
+            labels: Résultat à mémoriser
+        """
+        fd, tmp_path = tempfile.mkstemp(
+            suffix='.tmp', dir=self._cache_dir)
+        os.close(fd)
+        try:
+            ImageIO.write_lab(tmp_path, labels)
+            os.replace(tmp_path, self._path(key))
+        except OSError:
+            try:
+                os.remove(tmp_path)
+            except OSError:
+                pass
+            return
+
+        self._evict()
+
+    def _evict(self) -> None:
+        """
+        Supprime les entrées les moins récemment utilisées tant que le
+        répertoire dépasse le plafond.
+        """
+        if self._max_bytes <= 0:
+            return
+
+        entries = []
+        total = 0
+        try:
+            names = os.listdir(self._cache_dir)
+        except OSError:
+            return
+
+        for name in names:
+            if not name.endswith('.lab'):
+                continue
+            path = os.path.join(self._cache_dir, name)
+            try:
+                info = os.stat(path)
+            except OSError:
+                continue
+            entries.append((info.st_mtime, info.st_size, path))
+            total += info.st_size
+
+        if total <= self._max_bytes:
+            return
+
+        # Les plus anciennement utilisées d'abord
+        entries.sort()
+        for _, size, path in entries:
+            try:
+                os.remove(path)
+            except OSError:
+                continue
+            total -= size
+            if total <= self._max_bytes:
+                break
@@ -10,7 +10,10 @@ Contient des fonctions utilitaires pour :
 Auteurs : Romain Despoullain, Nicolas Marano, Amin Braham
 """
 
+import gc
+import os
 import time
+import tracemalloc
 from typing import List, Tuple, Union
 import math
 
@@ -261,6 +264,128 @@ def get_neighbors(x: int, y: int, width: int, height: int, connectivity: int = 4
     return neighbors
 
 
+def histogram(buffer) -> List[int]:
+    """
+    Calcule l'histogramme 256 bins d'un raster 8 bits en une passe.
+
+    Args:
+        buffer: Tampon plat de pixels (bytearray, memoryview ou bytes)
+
+    Returns:
+        Liste de 256 effectifs (hist[v] = nombre de pixels de valeur v)
+    """
+    hist = [0] * 256
+    for value in buffer:
+        hist[value] += 1
+    return hist
+
+
+def otsu_threshold(hist: List[int]) -> int:
+    """
+    Choisit un seuil de binarisation par la méthode d'Otsu.
+
+    Parcourt les 256 seuils possibles et retient celui qui maximise la
+    variance inter-classes (fond/objet) — le calcul ne touche que les
+    256 entrées de l'histogramme, jamais l'image.
+
+    Le seuil retourné suit la convention de binarize() : les pixels
+    >= seuil deviennent objet (255), les autres fond (0).
+
+    Args:
+        hist: Histogramme 256 bins (voir histogram())
+
+    Returns:
+        Seuil dans [1, 255] (128 pour un histogramme vide)
+    """
+    total = 0
+    weighted_total = 0
+    for value in range(256):
+        count = hist[value]
+        total += count
+        weighted_total += value * count
+
+    if total == 0:
+        return 128
+
+    sum_background = 0
+    weight_background = 0
+    best_variance = -1.0
+    best_threshold = 127
+
+    for t in range(256):
+        weight_background += hist[t]
+        if weight_background == 0:
+            continue
+        weight_foreground = total - weight_background
+        if weight_foreground == 0:
+            break
+
+        sum_background += t * hist[t]
+        mean_background = sum_background / weight_background
+        mean_foreground = (weighted_total - sum_background) / weight_foreground
+
+        diff = mean_background - mean_foreground
+        variance = weight_background * weight_foreground * diff * diff
+
+        if variance > best_variance:
+            best_variance = variance
+            best_threshold = t
+
+    # Les valeurs <= best_threshold sont le fond : avec la règle
+    # ">= seuil -> objet", le seuil effectif est le bin suivant
+    return best_threshold + 1
+
+
+def current_rss_kb() -> float:
+    """
+    Retourne la mémoire résidente (RSS) du processus en Ko.
+
+    Lit /proc/self/statm sous Linux ; replie sur le pic RSS de
+    getrusage sur les autres plateformes.
+
+    Returns:
+        RSS courante en kilo-octets
+    """
+    try:
+        with open('/proc/self/statm') as f:
+            pages = int(f.read().split()[1])
+        return pages * os.sysconf('SC_PAGE_SIZE') / 1024.0
+    except (OSError, ValueError, IndexError):
+        import resource
+        return float(resource.getrusage(resource.RUSAGE_SELF).ru_maxrss)
+
+
+def measure_peak_memory(func):
+    """
+    Exécute func() en mesurant sa consommation mémoire de pointe.
+
+    Deux métriques complémentaires sont relevées :
+    - pic tracemalloc : maximum d'octets alloués par l'allocateur
+      Python pendant l'appel (précis, mais ralentit l'exécution —
+      à mesurer HORS des runs chronométrés)
+    - delta RSS : croissance de la mémoire résidente du processus,
+      qui capture aussi les allocations hors allocateur Python
+
+    Args:
+        func: Fonction sans argument à mesurer
+
+    Returns:
+        Tuple (résultat de func, pic tracé en Ko, delta RSS en Ko)
+    """
+    gc.collect()
+    rss_before = current_rss_kb()
+
+    tracemalloc.start()
+    try:
+        result = func()
+        peak = tracemalloc.get_traced_memory()[1]
+    finally:
+        tracemalloc.stop()
+
+    rss_delta = current_rss_kb() - rss_before
+    return result, peak / 1024.0, rss_delta if rss_delta > 0 else 0.0
+
+
 class Timer:
     """
     Classe pour mesurer le temps d'exécution.